@@ -0,0 +1,56 @@
+#include "cassandra_cache_stats.hpp"
+#include "cassandra_client.hpp"
+#include "storage/cassandra_catalog.hpp"
+#include "duckdb/catalog/catalog.hpp"
+
+namespace duckdb {
+namespace cassandra {
+
+struct CassandraCacheStatsBindData : public TableFunctionData {
+    CassandraPreparedCacheStats stats;
+};
+
+struct CassandraCacheStatsState : public GlobalTableFunctionState {
+    bool finished = false;
+};
+
+static unique_ptr<FunctionData> CassandraCacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+    auto catalog_name = StringValue::Get(input.inputs[0]);
+    auto &catalog = Catalog::GetCatalog(context, catalog_name);
+    if (catalog.GetCatalogType() != "cassandra") {
+        throw BinderException("'%s' is not an attached Cassandra database", catalog_name);
+    }
+    auto bind_data = make_uniq<CassandraCacheStatsBindData>();
+    bind_data->stats = catalog.Cast<CassandraCatalog>().GetSharedClient()->GetPreparedCacheStats();
+    
+    names = {"hits", "misses", "entries", "capacity"};
+    return_types = {LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::UBIGINT};
+    return std::move(bind_data);
+}
+
+static unique_ptr<GlobalTableFunctionState> CassandraCacheStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<CassandraCacheStatsState>();
+}
+
+static void CassandraCacheStatsExecute(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
+    auto &bind_data = data.bind_data->Cast<CassandraCacheStatsBindData>();
+    auto &state = data.global_state->Cast<CassandraCacheStatsState>();
+    if (state.finished) {
+        return;
+    }
+    output.SetValue(0, 0, Value::UBIGINT(bind_data.stats.hits));
+    output.SetValue(1, 0, Value::UBIGINT(bind_data.stats.misses));
+    output.SetValue(2, 0, Value::UBIGINT(bind_data.stats.entries));
+    output.SetValue(3, 0, Value::UBIGINT(bind_data.stats.capacity));
+    output.SetCardinality(1);
+    state.finished = true;
+}
+
+CassandraPreparedCacheStatsFunction::CassandraPreparedCacheStatsFunction()
+    : TableFunction("cassandra_prepared_cache_stats", {LogicalType::VARCHAR}, CassandraCacheStatsExecute,
+                    CassandraCacheStatsBind, CassandraCacheStatsInit) {
+}
+
+} // namespace cassandra
+} // namespace duckdb
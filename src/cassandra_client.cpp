@@ -1,36 +1,84 @@
 #include "cassandra_client.hpp"
 #include "cassandra_types.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/logging/logger.hpp"
 #include "duckdb/parser/constraint.hpp"
+#include "duckdb/parser/parsed_data/create_table_info.hpp"
 #include <cassandra.h>
+#include <algorithm>
 #include <iterator>
 #include <mutex>
+#include <thread>
+#include <unordered_set>
 
 namespace duckdb {
 namespace cassandra {
 
-CassandraClient::CassandraClient(const CassandraConfig &config) : config(config), cluster(nullptr), session(nullptr), connection_valid(false) {
-    // Initialize DataStax C++ driver
-    cluster = cass_cluster_new();
-    session = cass_session_new();
-    
-    Connect();
-    connection_valid = true;
+// Number of distinct CQL statements kept prepared per client
+static constexpr idx_t CASSANDRA_PREPARED_CACHE_SIZE = 512;
+// Seconds between driver heartbeats on idle connections, and until a silent connection is dropped
+static constexpr unsigned CASSANDRA_HEARTBEAT_INTERVAL = 30;
+static constexpr unsigned CASSANDRA_IDLE_TIMEOUT = 60;
+// Time schema changes are given to reach every node, like the driver's own schema wait
+static constexpr int64_t CASSANDRA_SCHEMA_AGREEMENT_TIMEOUT_MS = 10000;
+static constexpr int64_t CASSANDRA_SCHEMA_AGREEMENT_POLL_MS = 200;
+
+static CassConsistency ParseConsistency(const string &name) {
+    static const std::pair<const char*, CassConsistency> levels[] = {
+        {"ANY", CASS_CONSISTENCY_ANY},
+        {"ONE", CASS_CONSISTENCY_ONE},
+        {"TWO", CASS_CONSISTENCY_TWO},
+        {"THREE", CASS_CONSISTENCY_THREE},
+        {"QUORUM", CASS_CONSISTENCY_QUORUM},
+        {"ALL", CASS_CONSISTENCY_ALL},
+        {"LOCAL_QUORUM", CASS_CONSISTENCY_LOCAL_QUORUM},
+        {"EACH_QUORUM", CASS_CONSISTENCY_EACH_QUORUM},
+        {"SERIAL", CASS_CONSISTENCY_SERIAL},
+        {"LOCAL_SERIAL", CASS_CONSISTENCY_LOCAL_SERIAL},
+        {"LOCAL_ONE", CASS_CONSISTENCY_LOCAL_ONE},
+    };
+    for (auto &level : levels) {
+        if (StringUtil::CIEquals(name, level.first)) {
+            return level.second;
+        }
+    }
+    throw InvalidInputException("Unknown Cassandra consistency level '%s'", name);
 }
 
-CassandraClient::~CassandraClient() {
-    Disconnect();
-    
-    // Free DataStax C++ driver resources
-    if (session) {
-        cass_session_free(session);
+static void CheckClusterOption(CassError error_code, const char* option) {
+    if (error_code != CASS_OK) {
+        throw InvalidInputException("Invalid Cassandra %s: %s", option, cass_error_desc(error_code));
     }
-    if (cluster) {
+}
+
+CassandraClient::CassandraClient(const CassandraConfig &config) : config(config) {
+    session = NewSession();
+}
+
+CassandraClient::~CassandraClient() {
+    // Requests still holding the session keep it, and its cluster, alive until they finish
+}
+
+shared_ptr<CassSession> CassandraClient::NewSession() {
+    // Initialize DataStax C++ driver
+    CassCluster* cluster = cass_cluster_new();
+    CassSession* new_session = cass_session_new();
+    try {
+        Connect(cluster, new_session);
+    } catch (...) {
+        cass_session_free(new_session);
         cass_cluster_free(cluster);
+        throw;
     }
+    // Freeing a connected session closes it first and waits for its requests to finish
+    return shared_ptr<CassSession>(new_session, [cluster](CassSession* session) {
+        cass_session_free(session);
+        cass_cluster_free(cluster);
+    });
 }
 
-void CassandraClient::Connect() {
+void CassandraClient::Connect(CassCluster* cluster, CassSession* target) {
     if (config.use_astra) {
         // Manual Astra configuration (no SCB needed)
         std::cout << "Configuring Astra connection manually..." << std::endl;
@@ -159,8 +207,50 @@ void CassandraClient::Connect() {
         std::cout << "SSL/TLS configuration applied" << std::endl;
     }
     
+    // Tuning, every knob left unset keeps the driver default
+    if (config.io_threads > 0) {
+        CheckClusterOption(cass_cluster_set_num_threads_io(cluster, config.io_threads), "io_threads");
+    }
+    if (config.core_connections_per_host > 0) {
+        CheckClusterOption(cass_cluster_set_core_connections_per_host(cluster, config.core_connections_per_host),
+                           "core_connections");
+    }
+    if (config.queue_size_io > 0) {
+        CheckClusterOption(cass_cluster_set_queue_size_io(cluster, config.queue_size_io), "queue_size");
+    }
+    if (config.request_timeout_ms > 0) {
+        cass_cluster_set_request_timeout(cluster, config.request_timeout_ms);
+    }
+    if (config.connect_timeout_ms > 0) {
+        cass_cluster_set_connect_timeout(cluster, config.connect_timeout_ms);
+    }
+    cass_cluster_set_tcp_nodelay(cluster, config.tcp_nodelay ? cass_true : cass_false);
+    cass_cluster_set_tcp_keepalive(cluster, config.tcp_keepalive_secs > 0 ? cass_true : cass_false,
+                                   config.tcp_keepalive_secs);
+    if (config.coalesce_delay_us >= 0) {
+        CheckClusterOption(cass_cluster_set_coalesce_delay(cluster, config.coalesce_delay_us), "coalesce_delay");
+    }
+    CheckClusterOption(cass_cluster_set_consistency(cluster, ParseConsistency(config.consistency)), "consistency");
+    if (!config.serial_consistency.empty()) {
+        CheckClusterOption(cass_cluster_set_serial_consistency(cluster, ParseConsistency(config.serial_consistency)),
+                           "serial_consistency");
+    }
+    
+    // Keep coordinators in the local data center and prefer replicas of the requested token,
+    // so a request does not hop through a remote or non-owning node
+    auto local_dc = config.local_dc.empty() && config.use_astra ? config.astra_dc : config.local_dc;
+    if (!local_dc.empty()) {
+        CheckClusterOption(cass_cluster_set_load_balance_dc_aware(cluster, local_dc.c_str(), 0, cass_false),
+                           "local_dc");
+    }
+    cass_cluster_set_token_aware_routing(cluster, config.token_aware ? cass_true : cass_false);
+    
+    // The driver heartbeats idle connections in the background and replaces dead ones itself
+    cass_cluster_set_connection_heartbeat_interval(cluster, CASSANDRA_HEARTBEAT_INTERVAL);
+    cass_cluster_set_connection_idle_timeout(cluster, CASSANDRA_IDLE_TIMEOUT);
+    
     // Connect to cluster
-    CassFuture* connect_future = cass_session_connect(session, cluster);
+    CassFuture* connect_future = cass_session_connect(target, cluster);
     
     // Check for connection errors
     if (cass_future_error_code(connect_future) != CASS_OK) {
@@ -176,14 +266,6 @@ void CassandraClient::Connect() {
               << ":" << config.port << std::endl;
 }
 
-void CassandraClient::Disconnect() {
-    if (session) {
-        CassFuture* close_future = cass_session_close(session);
-        cass_future_wait(close_future);
-        cass_future_free(close_future);
-    }
-}
-
 vector<CassandraKeyspaceRef> CassandraClient::GetKeyspaces() {
     vector<CassandraKeyspaceRef> keyspaces;
     
@@ -191,7 +273,8 @@ vector<CassandraKeyspaceRef> CassandraClient::GetKeyspaces() {
     const char* query = "SELECT keyspace_name FROM system_schema.keyspaces";
     
     CassStatement* statement = cass_statement_new(query, 0);
-    CassFuture* result_future = cass_session_execute(session, statement);
+    auto session = GetSession();
+    CassFuture* result_future = cass_session_execute(session.get(), statement);
     
     if (cass_future_error_code(result_future) == CASS_OK) {
         const CassResult* result = cass_future_get_result(result_future);
@@ -242,10 +325,11 @@ vector<CassandraTableRef> CassandraClient::GetTables(const string &keyspace_name
     // Query system.schema_tables table
     const char* query = "SELECT table_name FROM system_schema.tables WHERE keyspace_name = ?";
     
-    CassStatement* statement = cass_statement_new(query, 1);
+    CassStatement* statement = NewStatement(query);
     cass_statement_bind_string(statement, 0, keyspace_name.c_str());
     
-    CassFuture* result_future = cass_session_execute(session, statement);
+    auto session = GetSession();
+    CassFuture* result_future = cass_session_execute(session.get(), statement);
     
     if (cass_future_error_code(result_future) == CASS_OK) {
         const CassResult* result = cass_future_get_result(result_future);
@@ -308,9 +392,127 @@ void CassandraClient::CreateKeyspace(const CreateSchemaInfo &info, const Cassand
     throw NotImplementedException("CreateKeyspace not yet implemented");
 }
 
-void CassandraClient::CreateTable(const CreateTableInfo &info, const CassandraTableRef &table_ref) {
-    // TODO: Execute CREATE TABLE statement
-    throw NotImplementedException("CreateTable not yet implemented");
+void CassandraClient::CreateTable(ClientContext &context, const CreateTableInfo &info,
+                                  const CassandraTableRef &table_ref, const vector<string> &partition_key,
+                                  const vector<string> &clustering_key, const vector<bool> &clustering_descending) {
+    string columns;
+    for (auto &column : info.columns.Physical()) {
+        auto &name = column.Name();
+        // Collections in the primary key have to be frozen
+        bool key = std::find(partition_key.begin(), partition_key.end(), name) != partition_key.end() ||
+                   std::find(clustering_key.begin(), clustering_key.end(), name) != clustering_key.end();
+        columns += QuoteCQLIdentifier(name) + " " + CassandraTypeMapper::ToCQLType(column.Type(), key) + ", ";
+    }
+    string primary_key;
+    for (auto &name : partition_key) {
+        primary_key += (primary_key.empty() ? "(" : ", ") + QuoteCQLIdentifier(name);
+    }
+    primary_key += ")";
+    string clustering_order;
+    bool descending = false;
+    for (idx_t i = 0; i < clustering_key.size(); i++) {
+        primary_key += ", " + QuoteCQLIdentifier(clustering_key[i]);
+        clustering_order += (i > 0 ? ", " : "") + QuoteCQLIdentifier(clustering_key[i]) +
+                            (clustering_descending[i] ? " DESC" : " ASC");
+        descending = descending || clustering_descending[i];
+    }
+    
+    string query = "CREATE TABLE ";
+    if (info.on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT) {
+        query += "IF NOT EXISTS ";
+    }
+    query += table_ref.GetQualifiedName() + " (" + columns + "PRIMARY KEY (" + primary_key + "))";
+    if (descending) {
+        query += " WITH CLUSTERING ORDER BY (" + clustering_order + ")";
+    }
+    ExecuteSchemaChange(context, query);
+    
+    // The driver refreshes its schema metadata once the change is announced to it
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(CASSANDRA_SCHEMA_AGREEMENT_TIMEOUT_MS);
+    CassandraTableSchema schema;
+    while (!GetTableSchema(table_ref.keyspace_name, table_ref.table_name, schema)) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            throw IOException("Created Cassandra table %s but it did not appear in the schema metadata",
+                              table_ref.GetQualifiedName());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(CASSANDRA_SCHEMA_AGREEMENT_POLL_MS));
+    }
+}
+
+void CassandraClient::ExecuteStatement(CassStatement* statement, const string &query) {
+    auto session = GetSession();
+    CassFuture* future = cass_session_execute(session.get(), statement);
+    cass_statement_free(statement);
+    auto error_code = cass_future_error_code(future);
+    if (error_code != CASS_OK) {
+        auto message = GetErrorMessage(future);
+        cass_future_free(future);
+        ReportError(error_code);
+        throw IOException("Failed to execute '%s' on Cassandra: %s", query, message);
+    }
+    cass_future_free(future);
+}
+
+void CassandraClient::ExecuteSchemaChange(ClientContext &context, const string &query) {
+    CassStatement* statement = cass_statement_new_n(query.c_str(), query.size(), 0);
+    ConfigureStatement(statement, config);
+    ExecuteStatement(statement, query);
+    
+    // Writes sent before every node knows the new schema could fail on the nodes that do not
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(CASSANDRA_SCHEMA_AGREEMENT_TIMEOUT_MS);
+    while (!SchemaInAgreement()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            // The change itself succeeded; a node that is down keeps the versions apart until it returns
+            DUCKDB_LOG_WARNING(context,
+                               StringUtil::Format("Cassandra nodes did not agree on the schema after '%s'", query));
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(CASSANDRA_SCHEMA_AGREEMENT_POLL_MS));
+    }
+}
+
+bool CassandraClient::SchemaInAgreement() {
+    std::unordered_set<string> versions;
+    auto read_versions = [&](CassFuture* future) {
+        if (cass_future_error_code(future) != CASS_OK) {
+            return false;
+        }
+        const CassResult* result = cass_future_get_result(future);
+        CassIterator* rows = cass_iterator_from_result(result);
+        while (cass_iterator_next(rows)) {
+            CassUuid version;
+            // Peers that never reported a version are not counted
+            if (cass_value_get_uuid(cass_row_get_column(cass_iterator_get_row(rows), 0), &version) == CASS_OK) {
+                char text[CASS_UUID_STRING_LENGTH];
+                cass_uuid_string(version, text);
+                versions.insert(text);
+            }
+        }
+        cass_iterator_free(rows);
+        cass_result_free(result);
+        return true;
+    };
+    
+    // The peers have to be those of the same node, so both go through the same session
+    auto session = GetSession();
+    CassStatement* local = cass_statement_new("SELECT schema_version FROM system.local", 0);
+    CassFuture* local_future = cass_session_execute(session.get(), local);
+    cass_statement_free(local);
+    if (!read_versions(local_future)) {
+        cass_future_free(local_future);
+        return false;
+    }
+    CassStatement* peers = cass_statement_new("SELECT schema_version FROM system.peers", 0);
+    auto coordinator = cass_future_coordinator(local_future);
+    if (coordinator) {
+        cass_statement_set_node(peers, coordinator);
+    }
+    CassFuture* peers_future = cass_session_execute(session.get(), peers);
+    cass_statement_free(peers);
+    bool read = read_versions(peers_future);
+    cass_future_free(peers_future);
+    cass_future_free(local_future);
+    return read && versions.size() == 1;
 }
 
 void CassandraClient::DropKeyspace(const DropInfo &info) {
@@ -323,163 +525,457 @@ void CassandraClient::DropTable(const DropInfo &info) {
     throw NotImplementedException("DropTable not yet implemented");
 }
 
-void CassandraClient::GetTableInfo(const string &keyspace_name,
-                                   const string &table_name,
-                                   ColumnList &res_columns,
-                                   vector<unique_ptr<Constraint>> &res_constraints) {
+// Unquoted CQL names are stored lower case, so fall back to the lower case name
+static const CassKeyspaceMeta* FindKeyspaceMeta(const CassSchemaMeta* schema_meta, const string &keyspace_name) {
+    const CassKeyspaceMeta* keyspace_meta =
+        cass_schema_meta_keyspace_by_name_n(schema_meta, keyspace_name.c_str(), keyspace_name.size());
+    if (!keyspace_meta) {
+        auto lower_keyspace = StringUtil::Lower(keyspace_name);
+        keyspace_meta = cass_schema_meta_keyspace_by_name_n(schema_meta, lower_keyspace.c_str(), lower_keyspace.size());
+    }
+    return keyspace_meta;
+}
+
+uint32_t CassandraClient::GetSchemaVersion() {
+    // The driver refreshes its snapshot on every schema change event and bumps the version
+    const CassSchemaMeta* schema_meta = cass_session_get_schema_meta(GetSession().get());
+    if (!schema_meta) {
+        return 0;
+    }
+    auto version = cass_schema_meta_snapshot_version(schema_meta);
+    cass_schema_meta_free(schema_meta);
+    return version;
+}
+
+vector<string> CassandraClient::GetKeyspaceNames() {
+    vector<string> result;
+    const CassSchemaMeta* schema_meta = cass_session_get_schema_meta(GetSession().get());
+    if (!schema_meta) {
+        return result;
+    }
+    CassIterator* keyspaces = cass_iterator_keyspaces_from_schema_meta(schema_meta);
+    while (cass_iterator_next(keyspaces)) {
+        const char* name;
+        size_t name_length;
+        cass_keyspace_meta_name(cass_iterator_get_keyspace_meta(keyspaces), &name, &name_length);
+        result.push_back(string(name, name_length));
+    }
+    cass_iterator_free(keyspaces);
+    cass_schema_meta_free(schema_meta);
+    return result;
+}
+
+bool CassandraClient::GetKeyspaceMetadata(const string &keyspace_name, string &name, vector<string> &table_names) {
+    const CassSchemaMeta* schema_meta = cass_session_get_schema_meta(GetSession().get());
+    if (!schema_meta) {
+        return false;
+    }
+    const CassKeyspaceMeta* keyspace_meta = FindKeyspaceMeta(schema_meta, keyspace_name);
+    if (!keyspace_meta) {
+        cass_schema_meta_free(schema_meta);
+        return false;
+    }
+    const char* keyspace;
+    size_t keyspace_length;
+    cass_keyspace_meta_name(keyspace_meta, &keyspace, &keyspace_length);
+    name = string(keyspace, keyspace_length);
+    
+    CassIterator* tables = cass_iterator_tables_from_keyspace_meta(keyspace_meta);
+    while (cass_iterator_next(tables)) {
+        const char* table;
+        size_t table_length;
+        cass_table_meta_name(cass_iterator_get_table_meta(tables), &table, &table_length);
+        table_names.push_back(string(table, table_length));
+    }
+    cass_iterator_free(tables);
+    cass_schema_meta_free(schema_meta);
+    return true;
+}
+
+bool CassandraClient::GetTableSchema(const string &keyspace_name, const string &table_name,
+                                     CassandraTableSchema &result) {
+    const CassSchemaMeta* schema_meta = cass_session_get_schema_meta(GetSession().get());
+    if (!schema_meta) {
+        return false;
+    }
+    auto lower_table = StringUtil::Lower(table_name);
+    const CassKeyspaceMeta* keyspace_meta = FindKeyspaceMeta(schema_meta, keyspace_name);
+    const CassTableMeta* table_meta = nullptr;
+    if (keyspace_meta) {
+        table_meta = cass_keyspace_meta_table_by_name_n(keyspace_meta, table_name.c_str(), table_name.size());
+        if (!table_meta) {
+            table_meta = cass_keyspace_meta_table_by_name_n(keyspace_meta, lower_table.c_str(), lower_table.size());
+        }
+    }
+    if (!table_meta) {
+        cass_schema_meta_free(schema_meta);
+        return false;
+    }
     
-    // Query system_schema.columns to get column information
-    const char* query = 
-        "SELECT column_name, type, kind, position "
-        "FROM system_schema.columns "
-        "WHERE keyspace_name = ? AND table_name = ? "
-        "ORDER BY position ASC";
+    auto add_column = [&](const CassColumnMeta* column) {
+        const char* name;
+        size_t name_length;
+        cass_column_meta_name(column, &name, &name_length);
+        result.column_names.push_back(string(name, name_length));
+        result.column_types.push_back(CassandraType::FromDataType(cass_column_meta_data_type(column)));
+    };
+    for (size_t i = 0; i < cass_table_meta_partition_key_count(table_meta); i++) {
+        add_column(cass_table_meta_partition_key(table_meta, i));
+        result.partition_key.push_back(result.column_names.back());
+    }
+    for (size_t i = 0; i < cass_table_meta_clustering_key_count(table_meta); i++) {
+        add_column(cass_table_meta_clustering_key(table_meta, i));
+        result.clustering_key.push_back(result.column_names.back());
+        result.clustering_descending.push_back(cass_table_meta_clustering_key_order(table_meta, i) ==
+                                               CASS_CLUSTERING_ORDER_DESC);
+    }
+    
+    // Regular and static columns follow by name, like SELECT * returns them
+    vector<std::pair<string, const CassColumnMeta*>> other_columns;
+    CassIterator* columns = cass_iterator_columns_from_table_meta(table_meta);
+    while (cass_iterator_next(columns)) {
+        const CassColumnMeta* column = cass_iterator_get_column_meta(columns);
+        auto kind = cass_column_meta_type(column);
+        if (kind != CASS_COLUMN_TYPE_REGULAR && kind != CASS_COLUMN_TYPE_STATIC) {
+            continue;
+        }
+        const char* name;
+        size_t name_length;
+        cass_column_meta_name(column, &name, &name_length);
+        other_columns.emplace_back(string(name, name_length), column);
+    }
+    cass_iterator_free(columns);
+    std::sort(other_columns.begin(), other_columns.end(),
+              [](const std::pair<string, const CassColumnMeta*> &a, const std::pair<string, const CassColumnMeta*> &b) {
+                  return a.first < b.first;
+              });
+    for (auto &column : other_columns) {
+        add_column(column.second);
+    }
+    
+    // The metadata objects are owned by the snapshot, everything needed was copied out
+    cass_schema_meta_free(schema_meta);
+    return true;
+}
+
+vector<CassandraSizeEstimate> CassandraClient::GetSizeEstimates(ClientContext &context, const string &keyspace_name,
+                                                                const string &table_name) {
+    vector<CassandraSizeEstimate> estimates;
+    
+    const char* query =
+        "SELECT range_start, range_end, partitions_count, mean_partition_size "
+        "FROM system.size_estimates "
+        "WHERE keyspace_name = ? AND table_name = ?";
     
     CassStatement* statement = cass_statement_new(query, 2);
     cass_statement_bind_string(statement, 0, keyspace_name.c_str());
     cass_statement_bind_string(statement, 1, table_name.c_str());
     
-    CassFuture* result_future = cass_session_execute(session, statement);
+    auto session = GetSession();
+    CassFuture* result_future = cass_session_execute(session.get(), statement);
     
     if (cass_future_error_code(result_future) == CASS_OK) {
         const CassResult* result = cass_future_get_result(result_future);
         CassIterator* rows = cass_iterator_from_result(result);
         
-        vector<CassandraColumnInfo> columns;
-        
         while (cass_iterator_next(rows)) {
             const CassRow* row = cass_iterator_get_row(rows);
             
-            // Extract column information
-            CassandraColumnInfo col_info;
-            
-            // Column name
-            const CassValue* name_value = cass_row_get_column(row, 0);
-            const char* name_str;
-            size_t name_len;
-            cass_value_get_string(name_value, &name_str, &name_len);
-            col_info.column_name = std::string(name_str, name_len);
-            
-            // Type
-            const CassValue* type_value = cass_row_get_column(row, 1);
-            const char* type_str;
-            size_t type_len;
-            cass_value_get_string(type_value, &type_str, &type_len);
-            col_info.type = std::string(type_str, type_len);
-            
-            // Kind (partition_key, clustering, regular, static)
-            const CassValue* kind_value = cass_row_get_column(row, 2);
-            const char* kind_str;
-            size_t kind_len;
-            cass_value_get_string(kind_value, &kind_str, &kind_len);
-            col_info.kind = std::string(kind_str, kind_len);
-            
-            // Position
-            const CassValue* pos_value = cass_row_get_column(row, 3);
-            cass_int32_t position;
-            cass_value_get_int32(pos_value, &position);
-            col_info.position = position;
+            // Token bounds are stored as text
+            const char* start_str;
+            size_t start_len;
+            const char* end_str;
+            size_t end_len;
+            cass_value_get_string(cass_row_get_column(row, 0), &start_str, &start_len);
+            cass_value_get_string(cass_row_get_column(row, 1), &end_str, &end_len);
             
-            columns.push_back(col_info);
-        }
-        
-        // Convert to DuckDB ColumnList
-        for (const auto& col : columns) {
-            auto duckdb_type = col.GetDuckDBType();
-            auto column_def = ColumnDefinition(col.column_name, duckdb_type);
-            res_columns.AddColumn(std::move(column_def));
+            CassandraSizeEstimate estimate;
+            cass_int64_t partitions_count = 0;
+            cass_int64_t mean_partition_size = 0;
+            cass_value_get_int64(cass_row_get_column(row, 2), &partitions_count);
+            cass_value_get_int64(cass_row_get_column(row, 3), &mean_partition_size);
+            try {
+                estimate.range_start = std::stoll(std::string(start_str, start_len));
+                estimate.range_end = std::stoll(std::string(end_str, end_len));
+            } catch (const std::exception &) {
+                // Not a Murmur3 token (other partitioner), estimates are unusable
+                estimates.clear();
+                break;
+            }
+            estimate.partitions_count = partitions_count;
+            estimate.mean_partition_size = mean_partition_size;
+            estimates.push_back(estimate);
         }
         
-        // TODO: Add primary key constraint based on partition and clustering keys
-        // This requires finding the correct DuckDB constraint header
-        // vector<string> primary_key_columns;
-        // for (const auto& col : columns) {
-        //     if (col.kind == "partition_key" || col.kind == "clustering") {
-        //         primary_key_columns.push_back(col.column_name);
-        //     }
-        // }
-        
         cass_iterator_free(rows);
         cass_result_free(result);
-        
     } else {
-        const char* message;
-        size_t message_length;
-        cass_future_error_message(result_future, &message, &message_length);
-        std::cerr << "Error querying table schema: " << std::string(message, message_length) << std::endl;
-        throw InternalException("Failed to get table schema for %s.%s: %s", 
-                               keyspace_name, table_name, std::string(message, message_length));
+        // Estimates are only a hint; not being able to read them is not an error
+        DUCKDB_LOG_WARNING(context, StringUtil::Format("Failed to read Cassandra size estimates of %s.%s: %s",
+                                                       keyspace_name, table_name, GetErrorMessage(result_future)));
     }
     
     cass_future_free(result_future);
     cass_statement_free(statement);
+    
+    return estimates;
 }
 
-unique_ptr<QueryResult> CassandraClient::ExecuteQuery(const string &query) {
-    // TODO: Execute CQL query and return results
-    throw NotImplementedException("ExecuteQuery not yet implemented");
+unique_ptr<BaseStatistics> CassandraTableStatistics::GetColumnStatistics(const string &column_name,
+                                                                          const LogicalType &type) const {
+    auto entry = distinct_counts.find(column_name);
+    if (entry == distinct_counts.end()) {
+        return nullptr;
+    }
+    // Only facts that hold for every row: min/max of a sample are not bounds of the table
+    auto stats = BaseStatistics::CreateUnknown(type);
+    stats.Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+    stats.SetDistinctCount(entry->second);
+    return stats.ToUnique();
 }
 
-bool CassandraClient::IsConnected() const {
-    std::lock_guard<std::mutex> lock(connection_mutex);
-    if (!connection_valid || !session) {
-        return false;
+shared_ptr<const CassandraTableStatistics> CassandraClient::GetTableStatistics(ClientContext &context,
+                                                                              const CassandraTableRef &table_ref,
+                                                                              const vector<string> &partition_key,
+                                                                              const vector<string> &clustering_key,
+                                                                              const CassandraConfig &options) {
+    auto key = table_ref.GetQualifiedName();
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(statistics_mutex);
+        auto entry = statistics_cache.find(key);
+        if (entry != statistics_cache.end() &&
+            now - entry->second.loaded < std::chrono::seconds(options.statistics_ttl)) {
+            return entry->second.statistics;
+        }
     }
     
-    // Try a simple query to test the connection
-    // Use a low-level query that should work on any Cassandra cluster
-    CassStatement* test_statement = cass_statement_new("SELECT release_version FROM system.local", 0);
-    cass_statement_set_request_timeout(test_statement, 5000); // 5 second timeout
+    // Loaded without holding the lock; concurrent misses just load the same thing twice
+    auto result = make_shared_ptr<CassandraTableStatistics>();
+    result->estimates = GetSizeEstimates(context, table_ref.keyspace_name, table_ref.table_name);
+    result->size = CassandraTokenRanges::EstimateTableSize(result->estimates);
+    // Without estimates nothing is known, the key columns keep unknown statistics
+    if (result->size.has_estimates) {
+        result->rows = static_cast<idx_t>(result->size.partitions);
+        if (partition_key.size() == 1) {
+            result->distinct_counts[partition_key[0]] = MaxValue<idx_t>(result->rows, 1);
+        }
+        if (!partition_key.empty() && options.statistics_sample_rows > 0) {
+            SampleKeyColumns(context, table_ref, partition_key, clustering_key, options.statistics_sample_rows, *result);
+        }
+    }
     
-    CassFuture* test_future = cass_session_execute(session, test_statement);
-    CassError error_code = cass_future_error_code(test_future);
+    std::lock_guard<std::mutex> lock(statistics_mutex);
+    statistics_cache[key] = CachedStatistics {now, result};
+    return result;
+}
+
+void CassandraClient::SampleKeyColumns(ClientContext &context, const CassandraTableRef &table_ref,
+                                       const vector<string> &partition_key,
+                                       const vector<string> &clustering_key, int sample_rows,
+                                       CassandraTableStatistics &result) {
+    vector<string> columns = partition_key;
+    columns.insert(columns.end(), clustering_key.begin(), clustering_key.end());
+    string select_list;
+    for (auto &column : columns) {
+        select_list += (select_list.empty() ? "" : ", ") + QuoteCQLIdentifier(column);
+    }
+    string query = "SELECT " + select_list + " FROM " + table_ref.GetQualifiedName() + " LIMIT " +
+                   std::to_string(sample_rows);
+    CassStatement* statement = NewStatement(query);
+    auto session = GetSession();
+    CassFuture* result_future = cass_session_execute(session.get(), statement);
     
-    cass_future_free(test_future);
-    cass_statement_free(test_statement);
+    // Rows arrive grouped by partition, so a partition starts wherever the key changes
+    idx_t sampled_rows = 0;
+    idx_t sampled_partitions = 0;
+    string previous_partition;
+    vector<std::unordered_set<string>> distinct(columns.size());
+    if (cass_future_error_code(result_future) == CASS_OK) {
+        const CassResult* cass_result = cass_future_get_result(result_future);
+        CassIterator* rows = cass_iterator_from_result(cass_result);
+        while (cass_iterator_next(rows)) {
+            const CassRow* row = cass_iterator_get_row(rows);
+            string partition;
+            for (idx_t i = 0; i < columns.size(); i++) {
+                const cass_byte_t* bytes = nullptr;
+                size_t size = 0;
+                cass_value_get_bytes(cass_row_get_column(row, i), &bytes, &size);
+                string value(reinterpret_cast<const char*>(bytes), size);
+                if (i < partition_key.size()) {
+                    partition += std::to_string(size) + ":" + value;
+                }
+                distinct[i].insert(std::move(value));
+            }
+            if (sampled_rows == 0 || partition != previous_partition) {
+                sampled_partitions++;
+                previous_partition = std::move(partition);
+            }
+            sampled_rows++;
+        }
+        cass_iterator_free(rows);
+        cass_result_free(cass_result);
+    } else {
+        // Not fatal, the estimates from size_estimates alone are used
+        DUCKDB_LOG_WARNING(context, StringUtil::Format("Failed to sample key columns of Cassandra table %s: %s",
+                                                       table_ref.GetQualifiedName(), GetErrorMessage(result_future)));
+    }
+    cass_future_free(result_future);
+    cass_statement_free(statement);
+    if (sampled_rows == 0) {
+        return;
+    }
     
-    return (error_code == CASS_OK);
+    auto partitions = MaxValue<idx_t>(result.rows, 1);
+    if (!clustering_key.empty()) {
+        result.rows = static_cast<idx_t>(static_cast<double>(partitions) * static_cast<double>(sampled_rows) /
+                                         static_cast<double>(sampled_partitions));
+    }
+    for (idx_t i = 0; i < columns.size(); i++) {
+        auto sampled_distinct = distinct[i].size();
+        idx_t estimate = sampled_distinct;
+        if (i < partition_key.size()) {
+            // Unique within the sample: assume a new value for every partition
+            if (sampled_distinct == sampled_partitions) {
+                estimate = partitions;
+            }
+        } else if (sampled_distinct == sampled_rows) {
+            estimate = MaxValue<idx_t>(result.rows, 1);
+        }
+        result.distinct_counts[columns[i]] = estimate;
+    }
+}
+
+unique_ptr<QueryResult> CassandraClient::ExecuteQuery(const string &query) {
+    // TODO: Execute CQL query and return results
+    throw NotImplementedException("ExecuteQuery not yet implemented");
 }
 
 void CassandraClient::ResetConnection() {
-    std::lock_guard<std::mutex> lock(connection_mutex);
-    
-    // Mark connection as invalid
-    connection_valid = false;
-    
-    // Disconnect and cleanup current session
-    Disconnect();
+    // Only one thread reconnects, the others keep using the current session meanwhile
+    std::unique_lock<std::mutex> lock(connection_mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;
+    }
     
-    // Free and recreate session and cluster
-    if (session) {
-        cass_session_free(session);
-        session = nullptr;
+    // Connect a fresh cluster and session next to the current one
+    auto new_session = NewSession();
+    {
+        std::lock_guard<std::mutex> guard(session_mutex);
+        session.swap(new_session);
     }
-    if (cluster) {
-        cass_cluster_free(cluster);
-        cluster = nullptr;
+    // Prepared statements belong to the old session, prepare them again on next use
+    ClearPreparedCache();
+    // Requests still running on the old session hold it; it is closed once the last one is done
+    new_session.reset();
+}
+
+void CassandraClient::ReportError(CassError error_code) {
+    // Only errors saying no node could be reached call for a new session
+    if (error_code != CASS_ERROR_LIB_NO_HOSTS_AVAILABLE && error_code != CASS_ERROR_LIB_UNABLE_TO_CONNECT) {
+        return;
     }
-    
-    // Recreate cluster and session
-    cluster = cass_cluster_new();
-    session = cass_session_new();
-    
-    // Reconnect
-    Connect();
-    connection_valid = true;
+    // A failed reconnect throws a ConnectionException, which says more than the error of the request
+    ResetConnection();
+}
+
+std::string CassandraClient::GetErrorMessage(CassFuture* future) {
+    const char* message;
+    size_t message_length;
+    cass_future_error_message(future, &message, &message_length);
+    return std::string(message, message_length);
+}
+
+shared_ptr<CassSession> CassandraClient::GetSession() {
+    // Health is tracked by ReportError, not by probing here
+    std::lock_guard<std::mutex> guard(session_mutex);
+    return session;
+}
+
+void CassandraClient::ConfigureStatement(CassStatement* statement, const CassandraConfig &options) {
+    cass_statement_set_consistency(statement, ParseConsistency(options.consistency));
+    if (!options.serial_consistency.empty()) {
+        cass_statement_set_serial_consistency(statement, ParseConsistency(options.serial_consistency));
+    }
+    if (options.request_timeout_ms > 0) {
+        cass_statement_set_request_timeout(statement, options.request_timeout_ms);
+    }
+    if (options.page_size > 0) {
+        cass_statement_set_paging_size(statement, options.page_size);
+    }
+}
+
+void CassandraClient::ConfigureBatch(CassBatch* batch, const CassandraConfig &options) {
+    cass_batch_set_consistency(batch, ParseConsistency(options.consistency));
+    if (!options.serial_consistency.empty()) {
+        cass_batch_set_serial_consistency(batch, ParseConsistency(options.serial_consistency));
+    }
+    if (options.request_timeout_ms > 0) {
+        cass_batch_set_request_timeout(batch, options.request_timeout_ms);
+    }
+}
+
+CassStatement* CassandraClient::NewStatement(const string &query) {
+    auto prepared = GetPrepared(query);
+    // The statement keeps its own reference to the prepared metadata
+    return cass_prepared_bind(prepared.get());
 }
 
-CassSession* CassandraClient::GetSession() {
-    // Check if connection is valid, if not attempt recovery
-    if (!IsConnected()) {
-        try {
-            ResetConnection();
-        } catch (const std::exception& e) {
-            // If recovery fails, still return the session - let the caller handle the error
-            // This prevents infinite recursion and provides better error reporting
+shared_ptr<const CassPrepared> CassandraClient::GetPrepared(const string &query) {
+    {
+        std::lock_guard<std::mutex> lock(prepared_mutex);
+        auto entry = prepared_index.find(query);
+        if (entry != prepared_index.end()) {
+            prepared_lru.splice(prepared_lru.begin(), prepared_lru, entry->second);
+            prepared_hits++;
+            return entry->second->second;
         }
+        prepared_misses++;
     }
-    return session;
+    
+    // Prepare outside the lock so a slow round trip does not block other lookups
+    auto session = GetSession();
+    CassFuture* prepare_future = cass_session_prepare_n(session.get(), query.c_str(), query.size());
+    auto error_code = cass_future_error_code(prepare_future);
+    if (error_code != CASS_OK) {
+        auto message = GetErrorMessage(prepare_future);
+        cass_future_free(prepare_future);
+        ReportError(error_code);
+        throw IOException("Failed to prepare Cassandra query '%s': %s", query, message);
+    }
+    shared_ptr<const CassPrepared> prepared(cass_future_get_prepared(prepare_future), cass_prepared_free);
+    cass_future_free(prepare_future);
+    
+    std::lock_guard<std::mutex> lock(prepared_mutex);
+    auto entry = prepared_index.find(query);
+    if (entry != prepared_index.end()) {
+        // Another thread prepared the same query in the meantime
+        return entry->second->second;
+    }
+    prepared_lru.emplace_front(query, prepared);
+    prepared_index[query] = prepared_lru.begin();
+    if (prepared_lru.size() > CASSANDRA_PREPARED_CACHE_SIZE) {
+        prepared_index.erase(prepared_lru.back().first);
+        prepared_lru.pop_back();
+    }
+    return prepared;
+}
+
+void CassandraClient::ClearPreparedCache() {
+    std::lock_guard<std::mutex> lock(prepared_mutex);
+    prepared_index.clear();
+    prepared_lru.clear();
+}
+
+CassandraPreparedCacheStats CassandraClient::GetPreparedCacheStats() const {
+    std::lock_guard<std::mutex> lock(prepared_mutex);
+    CassandraPreparedCacheStats stats;
+    stats.hits = prepared_hits;
+    stats.misses = prepared_misses;
+    stats.entries = prepared_lru.size();
+    stats.capacity = CASSANDRA_PREPARED_CACHE_SIZE;
+    return stats;
 }
 
 } // namespace cassandra
-} // namespace duckdb
\ No newline at end of file
+} // namespace duckdb
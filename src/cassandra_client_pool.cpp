@@ -0,0 +1,128 @@
+#include "cassandra_client_pool.hpp"
+#include "cassandra_client.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace duckdb {
+namespace cassandra {
+
+// Idle clients are closed after this long
+static constexpr int64_t CASSANDRA_POOL_IDLE_SECONDS = 300;
+// Idle clients are closed early once the pool holds more than this many
+static constexpr idx_t CASSANDRA_POOL_MAX_CLIENTS = 16;
+
+CassandraClientPool &CassandraClientPool::Get() {
+    // Never destroyed: closing sessions from static destructors races the driver's own teardown
+    static auto pool = new CassandraClientPool();
+    return *pool;
+}
+
+string CassandraClientPool::GetKey(const CassandraConfig &config) {
+    // Contact points in any order or case reach the same cluster
+    string hosts;
+    if (config.use_astra) {
+        hosts = StringUtil::Lower(config.astra_host) + ":" + std::to_string(config.astra_port) + "/" + config.astra_dc;
+    } else {
+        auto points = StringUtil::Split(config.contact_points, ',');
+        for (auto &point : points) {
+            StringUtil::Trim(point);
+            point = StringUtil::Lower(point);
+        }
+        std::sort(points.begin(), points.end());
+        hosts = StringUtil::Join(points, ",") + ":" + std::to_string(config.port);
+    }
+
+    // Secrets only enter the key hashed
+    std::hash<string> hash;
+    auto credentials = config.use_astra ? config.client_id + '\0' + config.client_secret
+                                        : config.username + '\0' + config.password;
+    auto tls = config.cert_file_hex + '\0' + config.user_key_hex + '\0' + config.user_cert_hex + '\0' +
+               config.ca_cert_hex + '\0' + config.certfile_b64 + '\0' + config.userkey_b64 + '\0' +
+               config.usercert_b64 + '\0' + config.astra_ca_cert + '\0' + config.astra_client_cert + '\0' +
+               config.astra_client_key + '\0' + config.astra_ca_cert_b64 + '\0' + config.astra_client_cert_b64 +
+               '\0' + config.astra_client_key_b64;
+    // Options applied to the cluster; per-request options are set on each statement instead
+    auto tuning = std::to_string(config.io_threads) + "," + std::to_string(config.core_connections_per_host) + "," +
+                  std::to_string(config.queue_size_io) + "," + std::to_string(config.connect_timeout_ms) + "," +
+                  (config.tcp_nodelay ? "nodelay" : "delay") + "," + std::to_string(config.tcp_keepalive_secs) + "," +
+                  std::to_string(config.coalesce_delay_us) + "," + config.local_dc + "," +
+                  (config.token_aware ? "token_aware" : "round_robin");
+    return hosts + "|" + (config.use_astra ? "astra" : "cql") + "|" + std::to_string(hash(credentials)) + "|" +
+           (config.use_ssl ? "ssl" : "plain") + (config.verify_peer_cert ? "+verify" : "") + "|" +
+           std::to_string(hash(tls)) + "|" + tuning;
+}
+
+shared_ptr<CassandraClient> CassandraClientPool::Acquire(const CassandraConfig &config) {
+    auto key = GetKey(config);
+    auto now = std::chrono::steady_clock::now();
+    shared_ptr<PoolEntry> entry;
+    // Evicted clients are closed after the pool lock is released
+    vector<shared_ptr<PoolEntry>> evicted;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        EvictIdle(now, evicted);
+        auto &slot = entries[key];
+        if (!slot) {
+            slot = make_shared_ptr<PoolEntry>();
+        }
+        slot->last_used = now;
+        entry = slot;
+    }
+
+    // Connect outside the pool lock so other clusters are not held up by a slow handshake.
+    // A failed connect leaves the entry empty and the next lease tries again.
+    std::lock_guard<std::mutex> connect_guard(entry->connect_lock);
+    if (!entry->client) {
+        entry->client = make_shared_ptr<CassandraClient>(config);
+    }
+    return entry->client;
+}
+
+idx_t CassandraClientPool::Size() {
+    std::lock_guard<std::mutex> guard(lock);
+    return entries.size();
+}
+
+void CassandraClientPool::EvictIdle(std::chrono::steady_clock::time_point now,
+                                    vector<shared_ptr<PoolEntry>> &evicted) {
+    // A client is in use while anyone besides the pool holds it
+    vector<std::pair<std::chrono::steady_clock::time_point, string>> idle;
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.use_count() > 1) {
+            // A lease is connecting or returning it and may write client right now
+            ++it;
+            continue;
+        }
+        // Nobody else holds the entry, and getting it takes the pool lock, so client is stable
+        auto &entry = *it->second;
+        if (entry.client && entry.client.use_count() > 1) {
+            entry.last_used = now;
+            ++it;
+            continue;
+        }
+        if (now - entry.last_used >= std::chrono::seconds(CASSANDRA_POOL_IDLE_SECONDS)) {
+            evicted.push_back(std::move(it->second));
+            it = entries.erase(it);
+            continue;
+        }
+        idle.emplace_back(entry.last_used, it->first);
+        ++it;
+    }
+    if (entries.size() <= CASSANDRA_POOL_MAX_CLIENTS) {
+        return;
+    }
+    std::sort(idle.begin(), idle.end());
+    for (auto &candidate : idle) {
+        if (entries.size() <= CASSANDRA_POOL_MAX_CLIENTS) {
+            break;
+        }
+        auto entry = entries.find(candidate.second);
+        evicted.push_back(std::move(entry->second));
+        entries.erase(entry);
+    }
+}
+
+} // namespace cassandra
+} // namespace duckdb
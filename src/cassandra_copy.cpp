@@ -0,0 +1,337 @@
+#include "cassandra_copy.hpp"
+#include "cassandra_client.hpp"
+#include "cassandra_client_pool.hpp"
+#include "cassandra_settings.hpp"
+#include "cassandra_types.hpp"
+#include "cassandra_writer.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/logging/logger.hpp"
+
+#include <chrono>
+
+namespace duckdb {
+namespace cassandra {
+
+struct CassandraCopyBindData : public TableFunctionData {
+    CassandraConfig config;
+    CassandraTableRef table_ref;
+    // Written columns named like in the table, and the types the copied columns are cast to
+    vector<string> column_names;
+    vector<LogicalType> column_types;
+    vector<string> partition_key;
+    vector<string> clustering_key;
+    // Local file keeping the progress of the COPY, empty for none
+    string checkpoint_path;
+};
+
+struct CassandraCopyGlobalState : public GlobalFunctionData {
+    shared_ptr<CassandraWriteTarget> target;
+    std::chrono::steady_clock::time_point start;
+
+    // Batches arrive in the order of the copied rows and are flushed one at a time
+    mutex flush_lock;
+    unique_ptr<CassandraWriter> batch_writer;
+    DataChunk batch_chunk;
+    // Leading rows acknowledged by an earlier run of the same COPY
+    idx_t checkpoint_rows = 0;
+    // Leading rows flushed so far, including those skipped for the checkpoint
+    idx_t rows_flushed = 0;
+    idx_t rows_skipped = 0;
+};
+
+struct CassandraCopyLocalState : public LocalFunctionData {
+    unique_ptr<CassandraWriter> writer;
+    DataChunk chunk;
+};
+
+struct CassandraCopyBatch : public PreparedBatchData {
+    unique_ptr<ColumnDataCollection> collection;
+};
+
+// Progress of the COPY as kept in the checkpoint file
+static string CheckpointHeader(const CassandraCopyBindData &data) {
+    return "table=" + data.table_ref.GetQualifiedName() + "\ncolumns=" + StringUtil::Join(data.column_names, ",") +
+           "\n";
+}
+
+static idx_t ReadCheckpoint(ClientContext &context, const CassandraCopyBindData &data) {
+    auto &fs = FileSystem::GetFileSystem(context);
+    if (!fs.FileExists(data.checkpoint_path)) {
+        return 0;
+    }
+    auto handle = fs.OpenFile(data.checkpoint_path, FileFlags::FILE_FLAGS_READ);
+    auto size = NumericCast<idx_t>(handle->GetFileSize());
+    string contents(size, '\0');
+    handle->Read(const_cast<char*>(contents.data()), size);
+
+    // A checkpoint of another table or column list does not describe these rows
+    auto header = CheckpointHeader(data);
+    if (!StringUtil::StartsWith(contents, header + "rows=")) {
+        throw InvalidInputException("Checkpoint file \"%s\" belongs to a different COPY than this one into %s",
+                                    data.checkpoint_path, data.table_ref.GetQualifiedName());
+    }
+    return std::stoull(contents.substr(header.size() + 5));
+}
+
+static void WriteCheckpoint(ClientContext &context, const CassandraCopyBindData &data, idx_t rows) {
+    // Written next to the checkpoint and moved over it, so a crash never leaves half a file
+    auto &fs = FileSystem::GetFileSystem(context);
+    auto contents = CheckpointHeader(data) + "rows=" + std::to_string(rows) + "\n";
+    auto temp_path = data.checkpoint_path + ".tmp";
+    {
+        auto handle = fs.OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+        handle->Write(const_cast<char*>(contents.data()), contents.size());
+        handle->Sync();
+    }
+    fs.MoveFile(temp_path, data.checkpoint_path);
+}
+
+// Cast the copied columns in input to the types written into the table
+static DataChunk &CastChunk(ClientContext &context, const CassandraCopyBindData &data, DataChunk &input,
+                            DataChunk &result) {
+    result.Reset();
+    for (idx_t i = 0; i < input.ColumnCount(); i++) {
+        if (input.data[i].GetType() == data.column_types[i]) {
+            result.data[i].Reference(input.data[i]);
+        } else {
+            VectorOperations::Cast(context, input.data[i], result.data[i], input.size());
+        }
+    }
+    result.SetCardinality(input.size());
+    return result;
+}
+
+static unique_ptr<FunctionData> CassandraCopyBind(ClientContext &context, CopyFunctionBindInput &input,
+                                                  const vector<string> &names, const vector<LogicalType> &sql_types) {
+    auto bind_data = make_uniq<CassandraCopyBindData>();
+    auto &options = input.info.options;
+    auto get_option = [&](const string &name, const vector<Value> &values) {
+        if (values.size() != 1) {
+            throw BinderException("COPY to Cassandra option \"%s\" takes a single value", name);
+        }
+        return values[0];
+    };
+
+    // Options of the connection string come first, the others refine them
+    CassandraSettings::ApplyToConfig(context, bind_data->config);
+    auto connection = options.find("connection");
+    if (connection != options.end()) {
+        auto value = get_option(connection->first, connection->second);
+        bind_data->config = CassandraConfig::FromConnectionString(value.ToString(), bind_data->config);
+    }
+    for (auto &option : options) {
+        auto key = StringUtil::Lower(option.first);
+        if (key == "connection") {
+            continue;
+        }
+        auto value = get_option(option.first, option.second);
+        if (key == "checkpoint") {
+            bind_data->checkpoint_path = value.ToString();
+        } else if (key == "rate") {
+            bind_data->config.write_rate = value.GetValue<int64_t>();
+        } else if (key == "concurrency") {
+            bind_data->config.write_concurrency = value.GetValue<int32_t>();
+        } else if (key == "batch_size") {
+            bind_data->config.write_batch_size = value.GetValue<int32_t>();
+        } else if (key == "retries") {
+            bind_data->config.write_retries = value.GetValue<int32_t>();
+        } else if (key == "consistency") {
+            bind_data->config.consistency = value.ToString();
+        } else {
+            throw NotImplementedException("Unrecognized option for COPY to Cassandra: \"%s\"", option.first);
+        }
+    }
+
+    // The target is keyspace.table, or a table of the configured keyspace
+    auto &target = input.info.file_path;
+    auto dot_pos = target.find('.');
+    if (dot_pos != string::npos) {
+        bind_data->table_ref.keyspace_name = target.substr(0, dot_pos);
+        bind_data->table_ref.table_name = target.substr(dot_pos + 1);
+    } else if (!bind_data->config.keyspace.empty()) {
+        bind_data->table_ref.keyspace_name = bind_data->config.keyspace;
+        bind_data->table_ref.table_name = target;
+    } else {
+        throw BinderException("COPY to Cassandra needs a target of the form keyspace.table");
+    }
+
+    auto client = CassandraClientPool::Get().Acquire(bind_data->config);
+    CassandraTableSchema schema;
+    if (!client->GetTableSchema(bind_data->table_ref.keyspace_name, bind_data->table_ref.table_name, schema)) {
+        throw BinderException("Cassandra table %s does not exist", bind_data->table_ref.GetQualifiedName());
+    }
+    bind_data->partition_key = schema.partition_key;
+    bind_data->clustering_key = schema.clustering_key;
+
+    // Columns are matched by name and cast like an INSERT into the attached table would
+    for (idx_t i = 0; i < names.size(); i++) {
+        idx_t column = schema.column_names.size();
+        for (idx_t j = 0; j < schema.column_names.size(); j++) {
+            if (schema.column_names[j] == names[i] ||
+                (column == schema.column_names.size() && StringUtil::CIEquals(schema.column_names[j], names[i]))) {
+                column = j;
+            }
+        }
+        if (column == schema.column_names.size()) {
+            throw BinderException("Column \"%s\" is not a column of Cassandra table %s", names[i],
+                                  bind_data->table_ref.GetQualifiedName());
+        }
+        auto type = CassandraTypeMapper::ToDuckDBType(schema.column_types[column], bind_data->config.decimal_scale);
+        auto cass_type = schema.column_types[column].id;
+        if ((sql_types[i].id() == LogicalTypeId::VARCHAR &&
+             (cass_type == CASS_VALUE_TYPE_DECIMAL || cass_type == CASS_VALUE_TYPE_VARINT)) ||
+            (sql_types[i].id() == LogicalTypeId::DECIMAL && cass_type == CASS_VALUE_TYPE_DECIMAL)) {
+            // Written as is with its own scale, without rounding to another DuckDB decimal
+            type = sql_types[i];
+        }
+        bind_data->column_names.push_back(schema.column_names[column]);
+        bind_data->column_types.push_back(type);
+    }
+    return std::move(bind_data);
+}
+
+static unique_ptr<GlobalFunctionData> CassandraCopyInitGlobal(ClientContext &context, FunctionData &bind_data,
+                                                              const string &file_path) {
+    auto &data = bind_data.Cast<CassandraCopyBindData>();
+    auto result = make_uniq<CassandraCopyGlobalState>();
+    result->target = make_shared_ptr<CassandraWriteTarget>(
+        CassandraClientPool::Get().Acquire(data.config), data.table_ref, CassandraWriteType::INSERT_ROWS,
+        data.column_names, data.column_types, data.partition_key, data.clustering_key, data.config);
+    result->batch_chunk.Initialize(Allocator::Get(context), data.column_types);
+    if (!data.checkpoint_path.empty()) {
+        result->checkpoint_rows = ReadCheckpoint(context, data);
+    }
+    result->start = std::chrono::steady_clock::now();
+    return std::move(result);
+}
+
+static unique_ptr<LocalFunctionData> CassandraCopyInitLocal(ExecutionContext &context, FunctionData &bind_data) {
+    auto &data = bind_data.Cast<CassandraCopyBindData>();
+    auto result = make_uniq<CassandraCopyLocalState>();
+    result->chunk.Initialize(Allocator::Get(context.client), data.column_types);
+    return std::move(result);
+}
+
+static void CassandraCopySink(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+                              LocalFunctionData &lstate, DataChunk &input) {
+    auto &data = bind_data.Cast<CassandraCopyBindData>();
+    auto &global = gstate.Cast<CassandraCopyGlobalState>();
+    auto &local = lstate.Cast<CassandraCopyLocalState>();
+    if (!data.checkpoint_path.empty()) {
+        // Without batch indexes the rows arrive in no fixed order, so a count of them means nothing
+        throw InvalidInputException("COPY to Cassandra with CHECKPOINT needs the rows in a fixed order: keep "
+                                    "preserve_insertion_order enabled and copy from a source that keeps it");
+    }
+    if (!local.writer) {
+        local.writer = make_uniq<CassandraWriter>(global.target);
+    }
+    local.writer->Append(CastChunk(context.client, data, input, local.chunk));
+}
+
+static void CassandraCopyCombine(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+                                 LocalFunctionData &lstate) {
+    auto &local = lstate.Cast<CassandraCopyLocalState>();
+    if (local.writer) {
+        local.writer->Flush();
+    }
+}
+
+static unique_ptr<PreparedBatchData> CassandraCopyPrepareBatch(ClientContext &context, FunctionData &bind_data,
+                                                               GlobalFunctionData &gstate,
+                                                               unique_ptr<ColumnDataCollection> collection) {
+    auto result = make_uniq<CassandraCopyBatch>();
+    result->collection = std::move(collection);
+    return std::move(result);
+}
+
+static void CassandraCopyFlushBatch(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+                                    PreparedBatchData &batch) {
+    auto &data = bind_data.Cast<CassandraCopyBindData>();
+    auto &global = gstate.Cast<CassandraCopyGlobalState>();
+    auto &collection = *batch.Cast<CassandraCopyBatch>().collection;
+    lock_guard<mutex> guard(global.flush_lock);
+
+    auto batch_start = global.rows_flushed;
+    global.rows_flushed += collection.Count();
+    // Rows up to the checkpoint were acknowledged by an earlier run
+    idx_t skip = global.checkpoint_rows > batch_start ? global.checkpoint_rows - batch_start : 0;
+    skip = MinValue(skip, collection.Count());
+    global.rows_skipped += skip;
+    if (skip == collection.Count()) {
+        return;
+    }
+
+    if (!global.batch_writer) {
+        global.batch_writer = make_uniq<CassandraWriter>(global.target);
+    }
+    for (auto &chunk : collection.Chunks()) {
+        if (skip >= chunk.size()) {
+            skip -= chunk.size();
+            continue;
+        }
+        if (skip > 0) {
+            SelectionVector sel(chunk.size() - skip);
+            for (idx_t i = 0; i < chunk.size() - skip; i++) {
+                sel.set_index(i, skip + i);
+            }
+            chunk.Slice(sel, chunk.size() - skip);
+            skip = 0;
+        }
+        global.batch_writer->Append(CastChunk(context, data, chunk, global.batch_chunk));
+    }
+
+    if (!data.checkpoint_path.empty()) {
+        // Every row of this and the earlier batches is acknowledged once the writer is flushed
+        global.batch_writer->Flush();
+        WriteCheckpoint(context, data, global.rows_flushed);
+    }
+}
+
+static void CassandraCopyFinalize(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate) {
+    auto &data = bind_data.Cast<CassandraCopyBindData>();
+    auto &global = gstate.Cast<CassandraCopyGlobalState>();
+    if (global.batch_writer) {
+        global.batch_writer->Flush();
+    }
+    if (!data.checkpoint_path.empty()) {
+        // The COPY is complete, running it again starts over
+        FileSystem::GetFileSystem(context).TryRemoveFile(data.checkpoint_path);
+    }
+
+    auto &target = *global.target;
+    auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - global.start).count();
+    auto rows = target.rows_written.load();
+    // Reported through DuckDB's logger, visible in duckdb_logs() once logging is enabled
+    DUCKDB_LOG_INFO(context, StringUtil::Format("COPY to %s: %d rows written (%d skipped from checkpoint) in %.1f s, "
+                                                "%.0f rows/s, %d requests, %d retries, %d timeouts",
+                                                data.table_ref.GetQualifiedName(), rows, global.rows_skipped, seconds,
+                                                seconds > 0 ? static_cast<double>(rows) / seconds : 0.0,
+                                                target.requests.load(), target.retries.load(), target.timeouts.load()));
+}
+
+static CopyFunctionExecutionMode CassandraCopyExecutionMode(bool preserve_insertion_order,
+                                                            bool supports_batch_index) {
+    // Flushing batches in row order is what makes a checkpoint a prefix of the rows
+    if (preserve_insertion_order && supports_batch_index) {
+        return CopyFunctionExecutionMode::BATCH_COPY_TO_FILE;
+    }
+    return CopyFunctionExecutionMode::PARALLEL_COPY_TO_FILE;
+}
+
+CassandraCopyFunction::CassandraCopyFunction() : CopyFunction("cassandra") {
+    copy_to_bind = CassandraCopyBind;
+    copy_to_initialize_global = CassandraCopyInitGlobal;
+    copy_to_initialize_local = CassandraCopyInitLocal;
+    copy_to_sink = CassandraCopySink;
+    copy_to_combine = CassandraCopyCombine;
+    copy_to_finalize = CassandraCopyFinalize;
+    prepare_batch = CassandraCopyPrepareBatch;
+    flush_batch = CassandraCopyFlushBatch;
+    execution_mode = CassandraCopyExecutionMode;
+}
+
+} // namespace cassandra
+} // namespace duckdb
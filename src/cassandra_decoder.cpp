@@ -0,0 +1,889 @@
+#include "cassandra_decoder.hpp"
+#include "cassandra_types.hpp"
+#include "cassandra_utils.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/blob.hpp"
+#include "duckdb/common/types/cast_helpers.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/decimal.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace duckdb {
+namespace cassandra {
+
+namespace {
+
+// Cassandra DATE is an unsigned day count with the epoch at 2^31
+static constexpr int64_t CASSANDRA_DATE_EPOCH = 1LL << 31;
+
+// Per-type conversion from a non-NULL CassValue into the DuckDB physical value.
+// Returns false if the value could not be read.
+struct BooleanOp {
+    typedef bool TYPE;
+    static bool Get(const CassValue* value, bool &result) {
+        cass_bool_t bool_val;
+        if (cass_value_get_bool(value, &bool_val) != CASS_OK) {
+            return false;
+        }
+        result = bool_val == cass_true;
+        return true;
+    }
+};
+
+struct TinyIntOp {
+    typedef int8_t TYPE;
+    static bool Get(const CassValue* value, int8_t &result) {
+        return cass_value_get_int8(value, &result) == CASS_OK;
+    }
+};
+
+struct SmallIntOp {
+    typedef int16_t TYPE;
+    static bool Get(const CassValue* value, int16_t &result) {
+        return cass_value_get_int16(value, &result) == CASS_OK;
+    }
+};
+
+struct IntegerOp {
+    typedef int32_t TYPE;
+    static bool Get(const CassValue* value, int32_t &result) {
+        return cass_value_get_int32(value, &result) == CASS_OK;
+    }
+};
+
+struct BigIntOp {
+    typedef int64_t TYPE;
+    static bool Get(const CassValue* value, int64_t &result) {
+        cass_int64_t bigint_val;
+        if (cass_value_get_int64(value, &bigint_val) != CASS_OK) {
+            return false;
+        }
+        result = bigint_val;
+        return true;
+    }
+};
+
+struct FloatOp {
+    typedef float TYPE;
+    static bool Get(const CassValue* value, float &result) {
+        return cass_value_get_float(value, &result) == CASS_OK;
+    }
+};
+
+struct DoubleOp {
+    typedef double TYPE;
+    static bool Get(const CassValue* value, double &result) {
+        return cass_value_get_double(value, &result) == CASS_OK;
+    }
+};
+
+struct TimestampOp {
+    typedef timestamp_t TYPE;
+    static bool Get(const CassValue* value, timestamp_t &result) {
+        // Milliseconds since epoch
+        cass_int64_t timestamp_ms;
+        if (cass_value_get_int64(value, &timestamp_ms) != CASS_OK) {
+            return false;
+        }
+        result = timestamp_t(timestamp_ms * Interval::MICROS_PER_MSEC);
+        return true;
+    }
+};
+
+struct DateOp {
+    typedef date_t TYPE;
+    static bool Get(const CassValue* value, date_t &result) {
+        cass_uint32_t date_val;
+        if (cass_value_get_uint32(value, &date_val) != CASS_OK) {
+            return false;
+        }
+        result = date_t(static_cast<int32_t>(static_cast<int64_t>(date_val) - CASSANDRA_DATE_EPOCH));
+        return true;
+    }
+};
+
+struct TimeOp {
+    typedef dtime_t TYPE;
+    static bool Get(const CassValue* value, dtime_t &result) {
+        // Nanoseconds since midnight
+        cass_int64_t time_val;
+        if (cass_value_get_int64(value, &time_val) != CASS_OK) {
+            return false;
+        }
+        result = dtime_t(time_val / 1000);
+        return true;
+    }
+};
+
+struct IntervalOp {
+    typedef interval_t TYPE;
+    static bool Get(const CassValue* value, interval_t &result) {
+        // Months, days and nanoseconds, each a zigzag vint on the wire
+        cass_int32_t months;
+        cass_int32_t days;
+        cass_int64_t nanos;
+        if (cass_value_get_duration(value, &months, &days, &nanos) != CASS_OK) {
+            return false;
+        }
+        result.months = months;
+        result.days = days;
+        result.micros = nanos / Interval::NANOS_PER_MICRO;
+        return true;
+    }
+};
+
+struct UUIDOp {
+    typedef hugeint_t TYPE;
+    static bool Get(const CassValue* value, hugeint_t &result) {
+        CassUuid uuid_val;
+        if (cass_value_get_uuid(value, &uuid_val) != CASS_OK) {
+            return false;
+        }
+        result = CassandraTypeMapper::UUIDToHugeint(uuid_val);
+        return true;
+    }
+};
+
+[[noreturn]] void ThrowNumericOverflow(const LogicalType &type) {
+    if (type.id() == LogicalTypeId::DECIMAL) {
+        // Only reached when decimal_scale asked for DECIMAL instead of the exact text
+        throw InvalidInputException("Cassandra decimal does not fit %s set by decimal_scale, leave decimal_scale "
+                                    "unset to read decimals as exact text",
+                                    type.ToString());
+    }
+    throw InvalidInputException("Cassandra value does not fit %s", type.ToString());
+}
+
+struct VarintOp {
+    typedef hugeint_t TYPE;
+    static bool Get(const CassValue* value, hugeint_t &result) {
+        const cass_byte_t* bytes;
+        size_t size;
+        if (cass_value_get_bytes(value, &bytes, &size) != CASS_OK) {
+            return false;
+        }
+        if (!CassandraTypeMapper::VarintToHugeint(bytes, size, result)) {
+            ThrowNumericOverflow(LogicalType::HUGEINT);
+        }
+        return true;
+    }
+};
+
+// Bring an unscaled decimal from the scale it was written with to the column scale. Only
+// trailing zeros are dropped, a value with more significant decimals than the column fails.
+bool Rescale(hugeint_t &value, int64_t from, int64_t to) {
+    if (from < to) {
+        if (value == 0) {
+            return true;
+        }
+        if (to - from >= Hugeint::CACHED_POWERS_OF_TEN) {
+            return false;
+        }
+        return Hugeint::TryMultiply(value, Hugeint::POWERS_OF_TEN[to - from], value);
+    }
+    if (from > to) {
+        if (from - to >= Hugeint::CACHED_POWERS_OF_TEN) {
+            return value == 0;
+        }
+        auto divisor = Hugeint::POWERS_OF_TEN[from - to];
+        if (value % divisor != 0) {
+            return false;
+        }
+        value = value / divisor;
+    }
+    return true;
+}
+
+void StoreDecimal(const hugeint_t &value, int64_t &result) {
+    result = Hugeint::Cast<int64_t>(value);
+}
+
+void StoreDecimal(const hugeint_t &value, hugeint_t &result) {
+    result = value;
+}
+
+// Decimal value into the column's DECIMAL(width, scale) representation
+template <class T>
+bool GetDecimal(const CassValue* value, uint8_t width, uint8_t scale, T &result) {
+    const cass_byte_t* bytes;
+    size_t size;
+    cass_int32_t value_scale;
+    if (cass_value_get_decimal(value, &bytes, &size, &value_scale) != CASS_OK) {
+        return false;
+    }
+    if (size <= sizeof(int64_t) && value_scale == scale) {
+        // Common case: the unscaled value fits 64 bits and needs no rescaling
+        uint64_t unsigned_value = size > 0 && (bytes[0] & 0x80) ? ~uint64_t(0) : 0;
+        for (size_t i = 0; i < size; i++) {
+            unsigned_value = (unsigned_value << 8) | bytes[i];
+        }
+        auto unscaled = static_cast<int64_t>(unsigned_value);
+        if (width > Decimal::MAX_WIDTH_INT64 ||
+            (unscaled < NumericHelper::POWERS_OF_TEN[width] && unscaled > -NumericHelper::POWERS_OF_TEN[width])) {
+            result = unscaled;
+            return true;
+        }
+        ThrowNumericOverflow(LogicalType::DECIMAL(width, scale));
+    }
+    hugeint_t unscaled;
+    if (!CassandraTypeMapper::VarintToHugeint(bytes, size, unscaled) || !Rescale(unscaled, value_scale, scale) ||
+        unscaled >= Hugeint::POWERS_OF_TEN[width] || unscaled <= -Hugeint::POWERS_OF_TEN[width]) {
+        ThrowNumericOverflow(LogicalType::DECIMAL(width, scale));
+    }
+    StoreDecimal(unscaled, result);
+    return true;
+}
+
+template <class T>
+void DecodeDecimal(const CassandraColumnDecoder &decoder, const CassRow* const* rows, idx_t count, idx_t column,
+                   Vector &result, idx_t offset) {
+    auto data = FlatVector::GetData<T>(result);
+    auto &validity = FlatVector::Validity(result);
+    auto width = DecimalType::GetWidth(result.GetType());
+    auto scale = DecimalType::GetScale(result.GetType());
+    for (idx_t i = 0; i < count; i++) {
+        const CassValue* value = cass_row_get_column(rows[i], column);
+        if (cass_value_is_null(value) || !GetDecimal<T>(value, width, scale, data[offset + i])) {
+            validity.SetInvalid(offset + i);
+        }
+    }
+}
+
+template <class T>
+bool DecodeDecimalValue(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    auto &type = result.GetType();
+    return GetDecimal<T>(value, DecimalType::GetWidth(type), DecimalType::GetScale(type),
+                         FlatVector::GetData<T>(result)[index]);
+}
+
+// Exact text of an unscaled varint with the given scale
+string VarintToString(const cass_byte_t* bytes, size_t size, int32_t scale) {
+    bool negative = size > 0 && (bytes[0] & 0x80);
+    vector<uint8_t> magnitude(bytes, bytes + size);
+    if (negative) {
+        // Two's complement: invert and add one
+        bool carry = true;
+        for (idx_t i = magnitude.size(); i > 0; i--) {
+            magnitude[i - 1] = static_cast<uint8_t>(~magnitude[i - 1]);
+            if (carry) {
+                carry = ++magnitude[i - 1] == 0;
+            }
+        }
+    }
+    // Repeated long division by ten, least significant digit first
+    string digits;
+    idx_t start = 0;
+    while (true) {
+        while (start < magnitude.size() && magnitude[start] == 0) {
+            start++;
+        }
+        if (start == magnitude.size()) {
+            break;
+        }
+        uint32_t remainder = 0;
+        for (idx_t i = start; i < magnitude.size(); i++) {
+            uint32_t current = (remainder << 8) | magnitude[i];
+            magnitude[i] = static_cast<uint8_t>(current / 10);
+            remainder = current % 10;
+        }
+        digits += static_cast<char>('0' + remainder);
+    }
+    if (digits.empty()) {
+        digits = "0";
+    }
+    std::reverse(digits.begin(), digits.end());
+    if (scale < 0) {
+        digits.append(NumericCast<idx_t>(-static_cast<int64_t>(scale)), '0');
+    } else if (scale > 0) {
+        auto fraction_digits = NumericCast<idx_t>(scale);
+        if (digits.size() <= fraction_digits) {
+            digits.insert(0, fraction_digits - digits.size() + 1, '0');
+        }
+        digits.insert(digits.size() - fraction_digits, ".");
+    }
+    return negative ? "-" + digits : digits;
+}
+
+template <class OP>
+void DecodeFixed(const CassandraColumnDecoder &decoder, const CassRow* const* rows, idx_t count, idx_t column,
+                 Vector &result, idx_t offset) {
+    auto data = FlatVector::GetData<typename OP::TYPE>(result);
+    auto &validity = FlatVector::Validity(result);
+    for (idx_t i = 0; i < count; i++) {
+        const CassValue* value = cass_row_get_column(rows[i], column);
+        if (cass_value_is_null(value) || !OP::Get(value, data[offset + i])) {
+            validity.SetInvalid(offset + i);
+        }
+    }
+}
+
+// text, ascii and varchar columns
+void DecodeText(const CassandraColumnDecoder &decoder, const CassRow* const* rows, idx_t count, idx_t column,
+                Vector &result, idx_t offset) {
+    auto data = FlatVector::GetData<string_t>(result);
+    auto &validity = FlatVector::Validity(result);
+    for (idx_t i = 0; i < count; i++) {
+        const CassValue* value = cass_row_get_column(rows[i], column);
+        const char* str_val;
+        size_t str_len;
+        if (cass_value_is_null(value) || cass_value_get_string(value, &str_val, &str_len) != CASS_OK) {
+            validity.SetInvalid(offset + i);
+            data[offset + i] = string_t();
+            continue;
+        }
+        data[offset + i] = StringVector::AddString(result, str_val, str_len);
+    }
+}
+
+void DecodeBlob(const CassandraColumnDecoder &decoder, const CassRow* const* rows, idx_t count, idx_t column,
+                Vector &result, idx_t offset) {
+    auto data = FlatVector::GetData<string_t>(result);
+    auto &validity = FlatVector::Validity(result);
+    for (idx_t i = 0; i < count; i++) {
+        const CassValue* value = cass_row_get_column(rows[i], column);
+        const cass_byte_t* bytes;
+        size_t bytes_size;
+        if (cass_value_is_null(value) || cass_value_get_bytes(value, &bytes, &bytes_size) != CASS_OK) {
+            validity.SetInvalid(offset + i);
+            data[offset + i] = string_t();
+            continue;
+        }
+        data[offset + i] = StringVector::AddStringOrBlob(result, const_char_ptr_cast(bytes), bytes_size);
+    }
+}
+
+// Zero-copy variants: long strings point into the page, short ones are inlined by string_t
+void DecodeTextZeroCopy(const CassandraColumnDecoder &decoder, const CassRow* const* rows, idx_t count, idx_t column,
+                        Vector &result, idx_t offset) {
+    auto data = FlatVector::GetData<string_t>(result);
+    auto &validity = FlatVector::Validity(result);
+    for (idx_t i = 0; i < count; i++) {
+        const CassValue* value = cass_row_get_column(rows[i], column);
+        const char* str_val;
+        size_t str_len;
+        if (cass_value_is_null(value) || cass_value_get_string(value, &str_val, &str_len) != CASS_OK) {
+            validity.SetInvalid(offset + i);
+            data[offset + i] = string_t();
+            continue;
+        }
+        data[offset + i] = string_t(str_val, UnsafeNumericCast<uint32_t>(str_len));
+    }
+}
+
+void DecodeBlobZeroCopy(const CassandraColumnDecoder &decoder, const CassRow* const* rows, idx_t count, idx_t column,
+                        Vector &result, idx_t offset) {
+    auto data = FlatVector::GetData<string_t>(result);
+    auto &validity = FlatVector::Validity(result);
+    for (idx_t i = 0; i < count; i++) {
+        const CassValue* value = cass_row_get_column(rows[i], column);
+        const cass_byte_t* bytes;
+        size_t bytes_size;
+        if (cass_value_is_null(value) || cass_value_get_bytes(value, &bytes, &bytes_size) != CASS_OK) {
+            validity.SetInvalid(offset + i);
+            data[offset + i] = string_t();
+            continue;
+        }
+        data[offset + i] = string_t(const_char_ptr_cast(bytes), UnsafeNumericCast<uint32_t>(bytes_size));
+    }
+}
+
+// Any other Cassandra type exposed as VARCHAR
+void DecodeAsString(const CassandraColumnDecoder &decoder, const CassRow* const* rows, idx_t count, idx_t column,
+                    Vector &result, idx_t offset) {
+    auto data = FlatVector::GetData<string_t>(result);
+    auto &validity = FlatVector::Validity(result);
+    for (idx_t i = 0; i < count; i++) {
+        const CassValue* value = cass_row_get_column(rows[i], column);
+        if (cass_value_is_null(value)) {
+            validity.SetInvalid(offset + i);
+            data[offset + i] = string_t();
+            continue;
+        }
+        data[offset + i] = StringVector::AddString(result, CassandraDecoder::ValueToString(value));
+    }
+}
+
+template <class OP>
+bool DecodeFixedValue(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    return OP::Get(value, FlatVector::GetData<typename OP::TYPE>(result)[index]);
+}
+
+bool DecodeTextValue(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    const char* str_val;
+    size_t str_len;
+    if (cass_value_get_string(value, &str_val, &str_len) != CASS_OK) {
+        return false;
+    }
+    FlatVector::GetData<string_t>(result)[index] = StringVector::AddString(result, str_val, str_len);
+    return true;
+}
+
+bool DecodeBlobValue(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    const cass_byte_t* bytes;
+    size_t bytes_size;
+    if (cass_value_get_bytes(value, &bytes, &bytes_size) != CASS_OK) {
+        return false;
+    }
+    FlatVector::GetData<string_t>(result)[index] =
+        StringVector::AddStringOrBlob(result, const_char_ptr_cast(bytes), bytes_size);
+    return true;
+}
+
+bool DecodeAsStringValue(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    FlatVector::GetData<string_t>(result)[index] = StringVector::AddString(result, CassandraDecoder::ValueToString(value));
+    return true;
+}
+
+// Elements and fields may be NULL themselves
+void DecodeElement(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    if (!value || cass_value_is_null(value) || !decoder.decode_value(decoder, value, result, index)) {
+        FlatVector::SetNull(result, index, true);
+    }
+}
+
+// list and set values into a LIST vector, elements are appended to the child vector
+bool DecodeListValue(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    CassIterator* iterator = cass_iterator_from_collection(value);
+    if (!iterator) {
+        return false;
+    }
+    auto offset = ListVector::GetListSize(result);
+    idx_t count = cass_value_item_count(value);
+    ListVector::Reserve(result, offset + count);
+    auto &child = ListVector::GetEntry(result);
+    idx_t length = 0;
+    while (length < count && cass_iterator_next(iterator)) {
+        DecodeElement(decoder.children[0], cass_iterator_get_value(iterator), child, offset + length);
+        length++;
+    }
+    cass_iterator_free(iterator);
+    auto &entry = ListVector::GetData(result)[index];
+    entry.offset = offset;
+    entry.length = length;
+    ListVector::SetListSize(result, offset + length);
+    return true;
+}
+
+// map values into a MAP vector, i.e. a list of key/value structs
+bool DecodeMapValue(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    CassIterator* iterator = cass_iterator_from_map(value);
+    if (!iterator) {
+        return false;
+    }
+    auto offset = ListVector::GetListSize(result);
+    idx_t count = cass_value_item_count(value);
+    ListVector::Reserve(result, offset + count);
+    auto &entries = StructVector::GetEntries(ListVector::GetEntry(result));
+    idx_t length = 0;
+    while (length < count && cass_iterator_next(iterator)) {
+        DecodeElement(decoder.children[0], cass_iterator_get_map_key(iterator), *entries[0], offset + length);
+        DecodeElement(decoder.children[1], cass_iterator_get_map_value(iterator), *entries[1], offset + length);
+        length++;
+    }
+    cass_iterator_free(iterator);
+    auto &entry = ListVector::GetData(result)[index];
+    entry.offset = offset;
+    entry.length = length;
+    ListVector::SetListSize(result, offset + length);
+    return true;
+}
+
+// Fields missing from the value, e.g. UDT fields added after it was written, are NULL
+void SetMissingFieldsNull(vector<unique_ptr<Vector>> &entries, idx_t field, idx_t index) {
+    for (; field < entries.size(); field++) {
+        FlatVector::SetNull(*entries[field], index, true);
+    }
+}
+
+bool DecodeTupleValue(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    CassIterator* iterator = cass_iterator_from_tuple(value);
+    if (!iterator) {
+        return false;
+    }
+    auto &entries = StructVector::GetEntries(result);
+    idx_t field = 0;
+    while (field < entries.size() && cass_iterator_next(iterator)) {
+        DecodeElement(decoder.children[field], cass_iterator_get_value(iterator), *entries[field], index);
+        field++;
+    }
+    cass_iterator_free(iterator);
+    SetMissingFieldsNull(entries, field, index);
+    return true;
+}
+
+bool DecodeUserTypeValue(const CassandraColumnDecoder &decoder, const CassValue* value, Vector &result, idx_t index) {
+    CassIterator* iterator = cass_iterator_fields_from_user_type(value);
+    if (!iterator) {
+        return false;
+    }
+    // Fields come in definition order, which is also the order of the struct entries
+    auto &entries = StructVector::GetEntries(result);
+    idx_t field = 0;
+    while (field < entries.size() && cass_iterator_next(iterator)) {
+        DecodeElement(decoder.children[field], cass_iterator_get_user_type_field_value(iterator), *entries[field], index);
+        field++;
+    }
+    cass_iterator_free(iterator);
+    SetMissingFieldsNull(entries, field, index);
+    return true;
+}
+
+// Column of values that are decoded one by one, used for nested types
+void DecodeValues(const CassandraColumnDecoder &decoder, const CassRow* const* rows, idx_t count, idx_t column,
+                  Vector &result, idx_t offset) {
+    for (idx_t i = 0; i < count; i++) {
+        DecodeElement(decoder, cass_row_get_column(rows[i], column), result, offset + i);
+    }
+}
+
+CassandraColumnDecoder MakeDecoder(cassandra_decode_t decode, cassandra_decode_value_t decode_value,
+                                   bool references_page = false) {
+    CassandraColumnDecoder decoder;
+    decoder.decode = decode;
+    decoder.decode_value = decode_value;
+    decoder.references_page = references_page;
+    return decoder;
+}
+
+template <class OP>
+CassandraColumnDecoder FixedDecoder() {
+    return MakeDecoder(DecodeFixed<OP>, DecodeFixedValue<OP>);
+}
+
+} // namespace
+
+CassandraColumnDecoder CassandraDecoder::GetDecoder(const CassandraType &cass_type, const LogicalType &type,
+                                                    bool zero_copy) {
+    switch (type.id()) {
+        case LogicalTypeId::BOOLEAN:
+            return FixedDecoder<BooleanOp>();
+        case LogicalTypeId::TINYINT:
+            return FixedDecoder<TinyIntOp>();
+        case LogicalTypeId::SMALLINT:
+            return FixedDecoder<SmallIntOp>();
+        case LogicalTypeId::INTEGER:
+            return FixedDecoder<IntegerOp>();
+        case LogicalTypeId::BIGINT:
+            return FixedDecoder<BigIntOp>();
+        case LogicalTypeId::FLOAT:
+            return FixedDecoder<FloatOp>();
+        case LogicalTypeId::DOUBLE:
+            return FixedDecoder<DoubleOp>();
+        case LogicalTypeId::TIMESTAMP_TZ:
+            return FixedDecoder<TimestampOp>();
+        case LogicalTypeId::DATE:
+            return FixedDecoder<DateOp>();
+        case LogicalTypeId::TIME:
+            return FixedDecoder<TimeOp>();
+        case LogicalTypeId::UUID:
+            return FixedDecoder<UUIDOp>();
+        case LogicalTypeId::INTERVAL:
+            return FixedDecoder<IntervalOp>();
+        case LogicalTypeId::HUGEINT:
+            if (cass_type.id == CASS_VALUE_TYPE_VARINT) {
+                return FixedDecoder<VarintOp>();
+            }
+            break;
+        case LogicalTypeId::DECIMAL:
+            if (cass_type.id != CASS_VALUE_TYPE_DECIMAL) {
+                break;
+            }
+            switch (type.InternalType()) {
+                case PhysicalType::INT64:
+                    return MakeDecoder(DecodeDecimal<int64_t>, DecodeDecimalValue<int64_t>);
+                case PhysicalType::INT128:
+                    return MakeDecoder(DecodeDecimal<hugeint_t>, DecodeDecimalValue<hugeint_t>);
+                default:
+                    break;
+            }
+            break;
+        case LogicalTypeId::BLOB:
+            // inet values are read as their raw address bytes like blobs
+            if (zero_copy) {
+                return MakeDecoder(DecodeBlobZeroCopy, DecodeBlobValue, true);
+            }
+            return MakeDecoder(DecodeBlob, DecodeBlobValue);
+        case LogicalTypeId::VARCHAR:
+            switch (cass_type.id) {
+                case CASS_VALUE_TYPE_ASCII:
+                case CASS_VALUE_TYPE_TEXT:
+                case CASS_VALUE_TYPE_VARCHAR:
+                    if (zero_copy) {
+                        return MakeDecoder(DecodeTextZeroCopy, DecodeTextValue, true);
+                    }
+                    return MakeDecoder(DecodeText, DecodeTextValue);
+                default:
+                    return MakeDecoder(DecodeAsString, DecodeAsStringValue);
+            }
+        case LogicalTypeId::LIST:
+            if (cass_type.children.size() == 1) {
+                // Elements are always copied, the child vectors do not hold on to the page
+                auto decoder = MakeDecoder(DecodeValues, DecodeListValue);
+                decoder.children.push_back(GetDecoder(cass_type.children[0], ListType::GetChildType(type), false));
+                return decoder;
+            }
+            break;
+        case LogicalTypeId::MAP:
+            if (cass_type.id == CASS_VALUE_TYPE_MAP && cass_type.children.size() == 2) {
+                auto decoder = MakeDecoder(DecodeValues, DecodeMapValue);
+                decoder.children.push_back(GetDecoder(cass_type.children[0], MapType::KeyType(type), false));
+                decoder.children.push_back(GetDecoder(cass_type.children[1], MapType::ValueType(type), false));
+                return decoder;
+            }
+            break;
+        case LogicalTypeId::STRUCT:
+            if ((cass_type.id == CASS_VALUE_TYPE_TUPLE || cass_type.id == CASS_VALUE_TYPE_UDT) &&
+                cass_type.children.size() == StructType::GetChildCount(type)) {
+                auto decoder = MakeDecoder(DecodeValues, cass_type.id == CASS_VALUE_TYPE_TUPLE ? DecodeTupleValue
+                                                                                              : DecodeUserTypeValue);
+                for (idx_t i = 0; i < cass_type.children.size(); i++) {
+                    decoder.children.push_back(GetDecoder(cass_type.children[i], StructType::GetChildType(type, i), false));
+                }
+                return decoder;
+            }
+            break;
+        default:
+            break;
+    }
+    throw NotImplementedException("Cannot read Cassandra %s column as %s",
+                                  CassandraTypeMapper::GetCassandraTypeName(cass_type.id), type.ToString());
+}
+
+// Element of a collection, tuple or UDT in CQL literal syntax: NULLs are spelled out and
+// strings, dates and addresses are quoted
+static string ElementToString(const CassValue* value) {
+    if (!value || cass_value_is_null(value)) {
+        return "null";
+    }
+    switch (cass_value_type(value)) {
+        case CASS_VALUE_TYPE_ASCII:
+        case CASS_VALUE_TYPE_TEXT:
+        case CASS_VALUE_TYPE_VARCHAR:
+        case CASS_VALUE_TYPE_DATE:
+        case CASS_VALUE_TYPE_TIME:
+        case CASS_VALUE_TYPE_TIMESTAMP:
+        case CASS_VALUE_TYPE_INET:
+            return "'" + StringUtil::Replace(CassandraDecoder::ValueToString(value), "'", "''") + "'";
+        default:
+            return CassandraDecoder::ValueToString(value);
+    }
+}
+
+[[noreturn]] static void ThrowUnreadable(CassValueType value_type) {
+    throw InvalidInputException("Cannot read Cassandra %s value", CassandraTypeMapper::GetCassandraTypeName(value_type));
+}
+
+string CassandraDecoder::ValueToString(const CassValue* value) {
+    CassValueType value_type = cass_value_type(value);
+    switch (value_type) {
+        case CASS_VALUE_TYPE_ASCII:
+        case CASS_VALUE_TYPE_TEXT:
+        case CASS_VALUE_TYPE_VARCHAR: {
+            const char* str_val;
+            size_t str_len;
+            if (cass_value_get_string(value, &str_val, &str_len) != CASS_OK) {
+                ThrowUnreadable(value_type);
+            }
+            return string(str_val, str_len);
+        }
+        case CASS_VALUE_TYPE_BOOLEAN: {
+            bool bool_val;
+            if (!BooleanOp::Get(value, bool_val)) {
+                ThrowUnreadable(value_type);
+            }
+            return bool_val ? "true" : "false";
+        }
+        case CASS_VALUE_TYPE_TINY_INT: {
+            int8_t int_val;
+            if (!TinyIntOp::Get(value, int_val)) {
+                ThrowUnreadable(value_type);
+            }
+            return std::to_string(int_val);
+        }
+        case CASS_VALUE_TYPE_SMALL_INT: {
+            int16_t int_val;
+            if (!SmallIntOp::Get(value, int_val)) {
+                ThrowUnreadable(value_type);
+            }
+            return std::to_string(int_val);
+        }
+        case CASS_VALUE_TYPE_INT: {
+            int32_t int_val;
+            if (!IntegerOp::Get(value, int_val)) {
+                ThrowUnreadable(value_type);
+            }
+            return std::to_string(int_val);
+        }
+        case CASS_VALUE_TYPE_BIGINT:
+        case CASS_VALUE_TYPE_COUNTER: {
+            int64_t int_val;
+            if (!BigIntOp::Get(value, int_val)) {
+                ThrowUnreadable(value_type);
+            }
+            return std::to_string(int_val);
+        }
+        case CASS_VALUE_TYPE_FLOAT: {
+            float float_val;
+            if (!FloatOp::Get(value, float_val)) {
+                ThrowUnreadable(value_type);
+            }
+            // Shortest text that reads back as the same value
+            return Value::FLOAT(float_val).ToString();
+        }
+        case CASS_VALUE_TYPE_DOUBLE: {
+            double double_val;
+            if (!DoubleOp::Get(value, double_val)) {
+                ThrowUnreadable(value_type);
+            }
+            return Value::DOUBLE(double_val).ToString();
+        }
+        case CASS_VALUE_TYPE_VARINT: {
+            const cass_byte_t* varint_data;
+            size_t varint_size;
+            if (cass_value_get_bytes(value, &varint_data, &varint_size) != CASS_OK) {
+                ThrowUnreadable(value_type);
+            }
+            return VarintToString(varint_data, varint_size, 0);
+        }
+        case CASS_VALUE_TYPE_DECIMAL: {
+            const cass_byte_t* decimal_data;
+            size_t decimal_size;
+            cass_int32_t scale;
+            if (cass_value_get_decimal(value, &decimal_data, &decimal_size, &scale) != CASS_OK) {
+                ThrowUnreadable(value_type);
+            }
+            return VarintToString(decimal_data, decimal_size, scale);
+        }
+        case CASS_VALUE_TYPE_UUID:
+        case CASS_VALUE_TYPE_TIMEUUID: {
+            CassUuid uuid_val;
+            if (cass_value_get_uuid(value, &uuid_val) != CASS_OK) {
+                ThrowUnreadable(value_type);
+            }
+            char uuid_str[CASS_UUID_STRING_LENGTH];
+            cass_uuid_string(uuid_val, uuid_str);
+            return string(uuid_str);
+        }
+        case CASS_VALUE_TYPE_INET: {
+            CassInet inet_val;
+            if (cass_value_get_inet(value, &inet_val) != CASS_OK) {
+                ThrowUnreadable(value_type);
+            }
+            char inet_str[CASS_INET_STRING_LENGTH];
+            cass_inet_string(inet_val, inet_str);
+            return string(inet_str);
+        }
+        case CASS_VALUE_TYPE_DATE: {
+            date_t date_val;
+            if (!DateOp::Get(value, date_val)) {
+                ThrowUnreadable(value_type);
+            }
+            return Date::ToString(date_val);
+        }
+        case CASS_VALUE_TYPE_TIME: {
+            // Nanoseconds since midnight, all nine digits are kept
+            cass_int64_t time_val;
+            if (cass_value_get_int64(value, &time_val) != CASS_OK) {
+                ThrowUnreadable(value_type);
+            }
+            auto seconds = time_val / 1000000000;
+            char time_str[32];
+            snprintf(time_str, sizeof(time_str), "%02lld:%02lld:%02lld.%09lld", static_cast<long long>(seconds / 3600),
+                     static_cast<long long>(seconds / 60 % 60), static_cast<long long>(seconds % 60),
+                     static_cast<long long>(time_val % 1000000000));
+            return string(time_str);
+        }
+        case CASS_VALUE_TYPE_TIMESTAMP: {
+            timestamp_t timestamp_val;
+            if (!TimestampOp::Get(value, timestamp_val)) {
+                ThrowUnreadable(value_type);
+            }
+            return Timestamp::ToString(timestamp_val) + "+00";
+        }
+        case CASS_VALUE_TYPE_DURATION: {
+            interval_t interval_val;
+            if (!IntervalOp::Get(value, interval_val)) {
+                ThrowUnreadable(value_type);
+            }
+            return Interval::ToString(interval_val);
+        }
+        case CASS_VALUE_TYPE_BLOB:
+        case CASS_VALUE_TYPE_CUSTOM: {
+            // Hex like a CQL blob literal
+            const cass_byte_t* blob_data;
+            size_t blob_size;
+            if (cass_value_get_bytes(value, &blob_data, &blob_size) != CASS_OK) {
+                ThrowUnreadable(value_type);
+            }
+            string result = "0x";
+            for (size_t i = 0; i < blob_size; i++) {
+                result += Blob::HEX_TABLE[blob_data[i] >> 4];
+                result += Blob::HEX_TABLE[blob_data[i] & 0x0F];
+            }
+            return result;
+        }
+        case CASS_VALUE_TYPE_LIST:
+        case CASS_VALUE_TYPE_SET:
+        case CASS_VALUE_TYPE_TUPLE: {
+            CassIterator* iterator =
+                value_type == CASS_VALUE_TYPE_TUPLE ? cass_iterator_from_tuple(value) : cass_iterator_from_collection(value);
+            if (!iterator) {
+                ThrowUnreadable(value_type);
+            }
+            string result;
+            while (cass_iterator_next(iterator)) {
+                result += (result.empty() ? "" : ", ") + ElementToString(cass_iterator_get_value(iterator));
+            }
+            cass_iterator_free(iterator);
+            switch (value_type) {
+                case CASS_VALUE_TYPE_LIST:
+                    return "[" + result + "]";
+                case CASS_VALUE_TYPE_SET:
+                    return "{" + result + "}";
+                default:
+                    return "(" + result + ")";
+            }
+        }
+        case CASS_VALUE_TYPE_MAP: {
+            CassIterator* iterator = cass_iterator_from_map(value);
+            if (!iterator) {
+                ThrowUnreadable(value_type);
+            }
+            string result;
+            while (cass_iterator_next(iterator)) {
+                result += (result.empty() ? "" : ", ") + ElementToString(cass_iterator_get_map_key(iterator)) + ": " +
+                          ElementToString(cass_iterator_get_map_value(iterator));
+            }
+            cass_iterator_free(iterator);
+            return "{" + result + "}";
+        }
+        case CASS_VALUE_TYPE_UDT: {
+            CassIterator* iterator = cass_iterator_fields_from_user_type(value);
+            if (!iterator) {
+                ThrowUnreadable(value_type);
+            }
+            string result;
+            while (cass_iterator_next(iterator)) {
+                const char* name;
+                size_t name_length;
+                cass_iterator_get_user_type_field_name(iterator, &name, &name_length);
+                result += (result.empty() ? "" : ", ") + QuoteCQLIdentifier(string(name, name_length)) + ": " +
+                          ElementToString(cass_iterator_get_user_type_field_value(iterator));
+            }
+            cass_iterator_free(iterator);
+            return "{" + result + "}";
+        }
+        default:
+            throw NotImplementedException("Cannot read Cassandra %s values as text",
+                                          CassandraTypeMapper::GetCassandraTypeName(value_type));
+    }
+}
+
+} // namespace cassandra
+} // namespace duckdb
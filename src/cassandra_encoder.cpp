@@ -0,0 +1,652 @@
+#include "cassandra_encoder.hpp"
+#include "cassandra_types.hpp"
+
+#include <cstring>
+
+namespace duckdb {
+namespace cassandra {
+
+namespace {
+
+// Cassandra DATE is an unsigned day count with the epoch at 2^31
+static constexpr int64_t CASSANDRA_DATE_EPOCH = 1LL << 31;
+
+// Set a value on target through the driver call family matching where it goes
+#define CASSANDRA_ENCODE(TARGET, SUFFIX, ...)                                                                   \
+    ((TARGET).statement    ? cass_statement_bind_##SUFFIX((TARGET).statement, (TARGET).index, __VA_ARGS__)     \
+     : (TARGET).collection ? cass_collection_append_##SUFFIX((TARGET).collection, __VA_ARGS__)                  \
+     : (TARGET).tuple      ? cass_tuple_set_##SUFFIX((TARGET).tuple, (TARGET).index, __VA_ARGS__)              \
+                           : cass_user_type_set_##SUFFIX((TARGET).user_type, (TARGET).index, __VA_ARGS__))
+
+// Append value in big-endian byte order, as Cassandra serializes fixed size values
+template <class T>
+void AppendBigEndian(string &result, T value) {
+    for (idx_t i = sizeof(T); i > 0; i--) {
+        result += static_cast<char>((value >> (8 * (i - 1))) & 0xFF);
+    }
+}
+
+// Per-type conversion from the DuckDB physical value into the driver's representation, and for
+// the types a partition key can have into the bytes Cassandra stores
+struct BooleanOp {
+    typedef bool TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, bool value) {
+        return CASSANDRA_ENCODE(target, bool, value ? cass_true : cass_false);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, bool value, string &result) {
+        AppendBigEndian<uint8_t>(result, value ? 1 : 0);
+        return true;
+    }
+};
+
+struct TinyIntOp {
+    typedef int8_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, int8_t value) {
+        return CASSANDRA_ENCODE(target, int8, value);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, int8_t value, string &result) {
+        AppendBigEndian(result, static_cast<uint8_t>(value));
+        return true;
+    }
+};
+
+struct SmallIntOp {
+    typedef int16_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, int16_t value) {
+        return CASSANDRA_ENCODE(target, int16, value);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, int16_t value, string &result) {
+        AppendBigEndian(result, static_cast<uint16_t>(value));
+        return true;
+    }
+};
+
+struct IntegerOp {
+    typedef int32_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, int32_t value) {
+        return CASSANDRA_ENCODE(target, int32, value);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, int32_t value, string &result) {
+        AppendBigEndian(result, static_cast<uint32_t>(value));
+        return true;
+    }
+};
+
+struct BigIntOp {
+    typedef int64_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, int64_t value) {
+        return CASSANDRA_ENCODE(target, int64, value);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, int64_t value, string &result) {
+        AppendBigEndian(result, static_cast<uint64_t>(value));
+        return true;
+    }
+};
+
+struct FloatOp {
+    typedef float TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, float value) {
+        return CASSANDRA_ENCODE(target, float, value);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, float value, string &result) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        AppendBigEndian(result, bits);
+        return true;
+    }
+};
+
+struct DoubleOp {
+    typedef double TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, double value) {
+        return CASSANDRA_ENCODE(target, double, value);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, double value, string &result) {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        AppendBigEndian(result, bits);
+        return true;
+    }
+};
+
+struct TimestampOp {
+    typedef timestamp_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target,
+                            timestamp_t value) {
+        return CASSANDRA_ENCODE(target, int64, Millis(value));
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, timestamp_t value, string &result) {
+        AppendBigEndian(result, static_cast<uint64_t>(Millis(value)));
+        return true;
+    }
+    // Milliseconds since epoch, rounded down like the microseconds are
+    static int64_t Millis(timestamp_t value) {
+        auto millis = value.value / Interval::MICROS_PER_MSEC;
+        if (value.value % Interval::MICROS_PER_MSEC < 0) {
+            millis--;
+        }
+        return millis;
+    }
+};
+
+struct DateOp {
+    typedef date_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, date_t value) {
+        return CASSANDRA_ENCODE(target, uint32, static_cast<cass_uint32_t>(value.days + CASSANDRA_DATE_EPOCH));
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, date_t value, string &result) {
+        AppendBigEndian(result, static_cast<uint32_t>(value.days + CASSANDRA_DATE_EPOCH));
+        return true;
+    }
+};
+
+struct TimeOp {
+    typedef dtime_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, dtime_t value) {
+        // Nanoseconds since midnight
+        return CASSANDRA_ENCODE(target, int64, value.micros * Interval::NANOS_PER_MICRO);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, dtime_t value, string &result) {
+        AppendBigEndian(result, static_cast<uint64_t>(value.micros * Interval::NANOS_PER_MICRO));
+        return true;
+    }
+};
+
+struct IntervalOp {
+    typedef interval_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target,
+                            interval_t value) {
+        return CASSANDRA_ENCODE(target, duration, value.months, value.days, value.micros * Interval::NANOS_PER_MICRO);
+    }
+};
+
+struct UUIDOp {
+    typedef hugeint_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target,
+                            hugeint_t value) {
+        return CASSANDRA_ENCODE(target, uuid, CassandraTypeMapper::HugeintToUUID(value));
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, hugeint_t value, string &result) {
+        // The 16 bytes in the order of the text form; DuckDB flips the top bit to sort them
+        AppendBigEndian(result, static_cast<uint64_t>(value.upper) ^ (uint64_t(1) << 63));
+        AppendBigEndian(result, value.lower);
+        return true;
+    }
+};
+
+struct TextOp {
+    typedef string_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, string_t value) {
+        return CASSANDRA_ENCODE(target, string_n, value.GetData(), value.GetSize());
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, string_t value, string &result) {
+        result.append(value.GetData(), value.GetSize());
+        return true;
+    }
+};
+
+struct BlobOp {
+    typedef string_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, string_t value) {
+        return CASSANDRA_ENCODE(target, bytes, const_data_ptr_cast(value.GetData()), value.GetSize());
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, string_t value, string &result) {
+        result.append(value.GetData(), value.GetSize());
+        return true;
+    }
+};
+
+// inet columns are read as their raw address bytes, so they are written back from them
+struct InetOp {
+    typedef string_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, string_t value) {
+        auto address = const_data_ptr_cast(value.GetData());
+        CassInet inet;
+        if (value.GetSize() == CASS_INET_V4_LENGTH) {
+            inet = cass_inet_init_v4(address);
+        } else if (value.GetSize() == CASS_INET_V6_LENGTH) {
+            inet = cass_inet_init_v6(address);
+        } else {
+            return CASS_ERROR_LIB_INVALID_DATA;
+        }
+        return CASSANDRA_ENCODE(target, inet, inet);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, string_t value, string &result) {
+        if (value.GetSize() != CASS_INET_V4_LENGTH && value.GetSize() != CASS_INET_V6_LENGTH) {
+            return false;
+        }
+        result.append(value.GetData(), value.GetSize());
+        return true;
+    }
+};
+
+struct VarintOp {
+    typedef hugeint_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target,
+                            hugeint_t value) {
+        cass_byte_t bytes[sizeof(hugeint_t)];
+        auto size = CassandraTypeMapper::HugeintToVarint(value, bytes);
+        return CASSANDRA_ENCODE(target, bytes, bytes, size);
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, hugeint_t value, string &result) {
+        cass_byte_t bytes[sizeof(hugeint_t)];
+        auto size = CassandraTypeMapper::HugeintToVarint(value, bytes);
+        result.append(reinterpret_cast<const char*>(bytes), size);
+        return true;
+    }
+};
+
+hugeint_t UnscaledDecimal(int64_t value) {
+    return hugeint_t(value);
+}
+
+hugeint_t UnscaledDecimal(const hugeint_t &value) {
+    return value;
+}
+
+// DECIMAL(width, scale) values are written unscaled with the column scale
+template <class T>
+struct DecimalOp {
+    typedef T TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, T value) {
+        cass_byte_t bytes[sizeof(hugeint_t)];
+        auto size = CassandraTypeMapper::HugeintToVarint(UnscaledDecimal(value), bytes);
+        return CASSANDRA_ENCODE(target, decimal, bytes, size, encoder.scale);
+    }
+    // The scale, then the unscaled value
+    static bool Serialize(const CassandraColumnEncoder &encoder, T value, string &result) {
+        cass_byte_t bytes[sizeof(hugeint_t)];
+        auto size = CassandraTypeMapper::HugeintToVarint(UnscaledDecimal(value), bytes);
+        AppendBigEndian(result, static_cast<uint32_t>(encoder.scale));
+        result.append(reinterpret_cast<const char*>(bytes), size);
+        return true;
+    }
+};
+
+// Parse decimal text, e.g. "-12.50", into an unscaled big-endian two's complement varint
+bool ParseVarint(const string_t &text, vector<cass_byte_t> &bytes, int32_t &scale) {
+    auto data = text.GetData();
+    auto size = text.GetSize();
+    idx_t pos = 0;
+    bool negative = false;
+    if (pos < size && (data[pos] == '-' || data[pos] == '+')) {
+        negative = data[pos] == '-';
+        pos++;
+    }
+    // Magnitude as big-endian bytes, multiplied by ten for every digit
+    bytes.clear();
+    scale = 0;
+    bool has_digits = false;
+    bool fraction = false;
+    for (; pos < size; pos++) {
+        auto c = data[pos];
+        if (c == '.' && !fraction) {
+            fraction = true;
+            continue;
+        }
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        has_digits = true;
+        if (fraction) {
+            scale++;
+        }
+        uint32_t carry = static_cast<uint32_t>(c - '0');
+        for (idx_t i = bytes.size(); i > 0; i--) {
+            uint32_t current = bytes[i - 1] * 10U + carry;
+            bytes[i - 1] = static_cast<cass_byte_t>(current & 0xFF);
+            carry = current >> 8;
+        }
+        while (carry > 0) {
+            bytes.insert(bytes.begin(), static_cast<cass_byte_t>(carry & 0xFF));
+            carry >>= 8;
+        }
+    }
+    if (!has_digits) {
+        return false;
+    }
+    // Room for the sign bit
+    if (bytes.empty() || (bytes[0] & 0x80)) {
+        bytes.insert(bytes.begin(), 0);
+    }
+    if (negative) {
+        // Two's complement: invert and add one
+        bool carry = true;
+        for (idx_t i = bytes.size(); i > 0; i--) {
+            bytes[i - 1] = static_cast<cass_byte_t>(~bytes[i - 1]);
+            if (carry) {
+                carry = ++bytes[i - 1] == 0;
+            }
+        }
+    }
+    return true;
+}
+
+// decimal and varint values too large for DECIMAL and HUGEINT are read as text and written back from it
+struct NumericTextOp {
+    typedef string_t TYPE;
+    static CassError Encode(const CassandraColumnEncoder &encoder, const CassandraEncodeTarget &target, string_t value) {
+        vector<cass_byte_t> bytes;
+        int32_t scale;
+        if (!ParseVarint(value, bytes, scale)) {
+            return CASS_ERROR_LIB_INVALID_DATA;
+        }
+        if (encoder.cass_type == CASS_VALUE_TYPE_DECIMAL) {
+            return CASSANDRA_ENCODE(target, decimal, bytes.data(), bytes.size(), scale);
+        }
+        if (scale != 0) {
+            return CASS_ERROR_LIB_INVALID_DATA;
+        }
+        return CASSANDRA_ENCODE(target, bytes, bytes.data(), bytes.size());
+    }
+    static bool Serialize(const CassandraColumnEncoder &encoder, string_t value, string &result) {
+        vector<cass_byte_t> bytes;
+        int32_t scale;
+        if (!ParseVarint(value, bytes, scale)) {
+            return false;
+        }
+        if (encoder.cass_type == CASS_VALUE_TYPE_DECIMAL) {
+            AppendBigEndian(result, static_cast<uint32_t>(scale));
+        } else if (scale != 0) {
+            return false;
+        }
+        result.append(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        return true;
+    }
+};
+
+template <class OP>
+CassError EncodeFixed(const CassandraColumnEncoder &encoder, const RecursiveUnifiedVectorFormat &format, idx_t count,
+                      CassStatement* const* statements, idx_t index) {
+    auto data = UnifiedVectorFormat::GetData<typename OP::TYPE>(format.unified);
+    CassandraEncodeTarget target;
+    target.index = index;
+    for (idx_t i = 0; i < count; i++) {
+        auto idx = format.unified.sel->get_index(i);
+        if (!format.unified.validity.RowIsValid(idx)) {
+            // Unset rather than NULL, so no tombstone is written
+            continue;
+        }
+        target.statement = statements[i];
+        auto error = OP::Encode(encoder, target, data[idx]);
+        if (error != CASS_OK) {
+            return error;
+        }
+    }
+    return CASS_OK;
+}
+
+template <class OP>
+CassError EncodeFixedValue(const CassandraColumnEncoder &encoder, const RecursiveUnifiedVectorFormat &format, idx_t idx,
+                           const CassandraEncodeTarget &target) {
+    return OP::Encode(encoder, target, UnifiedVectorFormat::GetData<typename OP::TYPE>(format.unified)[idx]);
+}
+
+template <class OP>
+bool SerializeFixedValue(const CassandraColumnEncoder &encoder, const UnifiedVectorFormat &format, idx_t idx,
+                         string &result) {
+    return OP::Serialize(encoder, UnifiedVectorFormat::GetData<typename OP::TYPE>(format)[idx], result);
+}
+
+// Tuple and UDT fields may be NULL, collection elements may not
+CassError EncodeElement(const CassandraColumnEncoder &encoder, const RecursiveUnifiedVectorFormat &format, idx_t row,
+                        const CassandraEncodeTarget &target) {
+    auto idx = format.unified.sel->get_index(row);
+    if (format.unified.validity.RowIsValid(idx)) {
+        return encoder.encode_value(encoder, format, idx, target);
+    }
+    if (target.tuple) {
+        return cass_tuple_set_null(target.tuple, target.index);
+    }
+    if (target.user_type) {
+        return cass_user_type_set_null(target.user_type, target.index);
+    }
+    return CASS_ERROR_LIB_NULL_VALUE;
+}
+
+// LIST values into list and set parameters
+CassError EncodeListValue(const CassandraColumnEncoder &encoder, const RecursiveUnifiedVectorFormat &format, idx_t idx,
+                          const CassandraEncodeTarget &target) {
+    auto &entry = UnifiedVectorFormat::GetData<list_entry_t>(format.unified)[idx];
+    CassandraEncodeTarget element;
+    element.collection = cass_collection_new_from_data_type(encoder.data_type, entry.length);
+    auto error = CASS_OK;
+    for (idx_t i = 0; i < entry.length && error == CASS_OK; i++) {
+        error = EncodeElement(encoder.children[0], format.children[0], entry.offset + i, element);
+    }
+    if (error == CASS_OK) {
+        error = CASSANDRA_ENCODE(target, collection, element.collection);
+    }
+    cass_collection_free(element.collection);
+    return error;
+}
+
+// MAP values, i.e. lists of key/value structs
+CassError EncodeMapValue(const CassandraColumnEncoder &encoder, const RecursiveUnifiedVectorFormat &format, idx_t idx,
+                         const CassandraEncodeTarget &target) {
+    auto &entry = UnifiedVectorFormat::GetData<list_entry_t>(format.unified)[idx];
+    auto &entries = format.children[0];
+    CassandraEncodeTarget element;
+    element.collection = cass_collection_new_from_data_type(encoder.data_type, entry.length);
+    auto error = CASS_OK;
+    for (idx_t i = 0; i < entry.length && error == CASS_OK; i++) {
+        auto entry_idx = entries.unified.sel->get_index(entry.offset + i);
+        error = EncodeElement(encoder.children[0], entries.children[0], entry_idx, element);
+        if (error == CASS_OK) {
+            error = EncodeElement(encoder.children[1], entries.children[1], entry_idx, element);
+        }
+    }
+    if (error == CASS_OK) {
+        error = CASSANDRA_ENCODE(target, collection, element.collection);
+    }
+    cass_collection_free(element.collection);
+    return error;
+}
+
+CassError EncodeTupleValue(const CassandraColumnEncoder &encoder, const RecursiveUnifiedVectorFormat &format, idx_t idx,
+                           const CassandraEncodeTarget &target) {
+    CassandraEncodeTarget field;
+    field.tuple = cass_tuple_new_from_data_type(encoder.data_type);
+    auto error = CASS_OK;
+    for (idx_t i = 0; i < encoder.children.size() && error == CASS_OK; i++) {
+        field.index = i;
+        error = EncodeElement(encoder.children[i], format.children[i], idx, field);
+    }
+    if (error == CASS_OK) {
+        error = CASSANDRA_ENCODE(target, tuple, field.tuple);
+    }
+    cass_tuple_free(field.tuple);
+    return error;
+}
+
+CassError EncodeUserTypeValue(const CassandraColumnEncoder &encoder, const RecursiveUnifiedVectorFormat &format,
+                              idx_t idx, const CassandraEncodeTarget &target) {
+    // Struct entries are in field definition order, like the fields of the data type
+    CassandraEncodeTarget field;
+    field.user_type = cass_user_type_new_from_data_type(encoder.data_type);
+    auto error = CASS_OK;
+    for (idx_t i = 0; i < encoder.children.size() && error == CASS_OK; i++) {
+        field.index = i;
+        error = EncodeElement(encoder.children[i], format.children[i], idx, field);
+    }
+    if (error == CASS_OK) {
+        error = CASSANDRA_ENCODE(target, user_type, field.user_type);
+    }
+    cass_user_type_free(field.user_type);
+    return error;
+}
+
+// Column of values that are encoded one by one, used for nested types
+CassError EncodeValues(const CassandraColumnEncoder &encoder, const RecursiveUnifiedVectorFormat &format, idx_t count,
+                       CassStatement* const* statements, idx_t index) {
+    CassandraEncodeTarget target;
+    target.index = index;
+    for (idx_t i = 0; i < count; i++) {
+        auto idx = format.unified.sel->get_index(i);
+        if (!format.unified.validity.RowIsValid(idx)) {
+            continue;
+        }
+        target.statement = statements[i];
+        auto error = encoder.encode_value(encoder, format, idx, target);
+        if (error != CASS_OK) {
+            return error;
+        }
+    }
+    return CASS_OK;
+}
+
+CassandraColumnEncoder MakeEncoder(const CassDataType* data_type, cassandra_encode_t encode,
+                                   cassandra_encode_value_t encode_value) {
+    CassandraColumnEncoder encoder;
+    encoder.encode = encode;
+    encoder.encode_value = encode_value;
+    encoder.data_type = data_type;
+    encoder.cass_type = cass_data_type_type(data_type);
+    return encoder;
+}
+
+template <class OP>
+CassandraColumnEncoder FixedEncoder(const CassDataType* data_type) {
+    return MakeEncoder(data_type, EncodeFixed<OP>, EncodeFixedValue<OP>);
+}
+
+// Encoder of a type that may be part of a partition key
+template <class OP>
+CassandraColumnEncoder KeyEncoder(const CassDataType* data_type) {
+    auto encoder = FixedEncoder<OP>(data_type);
+    encoder.serialize = SerializeFixedValue<OP>;
+    return encoder;
+}
+
+} // namespace
+
+CassandraColumnEncoder CassandraEncoder::GetEncoder(const CassDataType* data_type, const LogicalType &type) {
+    auto cass_type = cass_data_type_type(data_type);
+    switch (type.id()) {
+        case LogicalTypeId::BOOLEAN:
+            return KeyEncoder<BooleanOp>(data_type);
+        case LogicalTypeId::TINYINT:
+            return KeyEncoder<TinyIntOp>(data_type);
+        case LogicalTypeId::SMALLINT:
+            return KeyEncoder<SmallIntOp>(data_type);
+        case LogicalTypeId::INTEGER:
+            return KeyEncoder<IntegerOp>(data_type);
+        case LogicalTypeId::BIGINT:
+            return KeyEncoder<BigIntOp>(data_type);
+        case LogicalTypeId::FLOAT:
+            return KeyEncoder<FloatOp>(data_type);
+        case LogicalTypeId::DOUBLE:
+            return KeyEncoder<DoubleOp>(data_type);
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ:
+            return KeyEncoder<TimestampOp>(data_type);
+        case LogicalTypeId::DATE:
+            return KeyEncoder<DateOp>(data_type);
+        case LogicalTypeId::TIME:
+            return KeyEncoder<TimeOp>(data_type);
+        case LogicalTypeId::UUID:
+            return KeyEncoder<UUIDOp>(data_type);
+        case LogicalTypeId::INTERVAL:
+            return FixedEncoder<IntervalOp>(data_type);
+        case LogicalTypeId::HUGEINT:
+            if (cass_type == CASS_VALUE_TYPE_VARINT) {
+                return KeyEncoder<VarintOp>(data_type);
+            }
+            break;
+        case LogicalTypeId::DECIMAL: {
+            if (cass_type != CASS_VALUE_TYPE_DECIMAL) {
+                break;
+            }
+            CassandraColumnEncoder encoder;
+            switch (type.InternalType()) {
+                case PhysicalType::INT16:
+                    encoder = KeyEncoder<DecimalOp<int16_t>>(data_type);
+                    break;
+                case PhysicalType::INT32:
+                    encoder = KeyEncoder<DecimalOp<int32_t>>(data_type);
+                    break;
+                case PhysicalType::INT64:
+                    encoder = KeyEncoder<DecimalOp<int64_t>>(data_type);
+                    break;
+                default:
+                    encoder = KeyEncoder<DecimalOp<hugeint_t>>(data_type);
+                    break;
+            }
+            encoder.scale = DecimalType::GetScale(type);
+            return encoder;
+        }
+        case LogicalTypeId::BLOB:
+            if (cass_type == CASS_VALUE_TYPE_INET) {
+                return KeyEncoder<InetOp>(data_type);
+            }
+            return KeyEncoder<BlobOp>(data_type);
+        case LogicalTypeId::VARCHAR:
+            switch (cass_type) {
+                case CASS_VALUE_TYPE_ASCII:
+                case CASS_VALUE_TYPE_TEXT:
+                case CASS_VALUE_TYPE_VARCHAR:
+                    return KeyEncoder<TextOp>(data_type);
+                case CASS_VALUE_TYPE_DECIMAL:
+                case CASS_VALUE_TYPE_VARINT:
+                    return KeyEncoder<NumericTextOp>(data_type);
+                default:
+                    break;
+            }
+            break;
+        case LogicalTypeId::LIST:
+            if ((cass_type == CASS_VALUE_TYPE_LIST || cass_type == CASS_VALUE_TYPE_SET) &&
+                cass_data_type_sub_type_count(data_type) == 1) {
+                auto encoder = MakeEncoder(data_type, EncodeValues, EncodeListValue);
+                encoder.children.push_back(
+                    GetEncoder(cass_data_type_sub_data_type(data_type, 0), ListType::GetChildType(type)));
+                return encoder;
+            }
+            break;
+        case LogicalTypeId::MAP:
+            if (cass_type == CASS_VALUE_TYPE_MAP && cass_data_type_sub_type_count(data_type) == 2) {
+                auto encoder = MakeEncoder(data_type, EncodeValues, EncodeMapValue);
+                encoder.children.push_back(GetEncoder(cass_data_type_sub_data_type(data_type, 0), MapType::KeyType(type)));
+                encoder.children.push_back(
+                    GetEncoder(cass_data_type_sub_data_type(data_type, 1), MapType::ValueType(type)));
+                return encoder;
+            }
+            break;
+        case LogicalTypeId::STRUCT:
+            if ((cass_type == CASS_VALUE_TYPE_TUPLE || cass_type == CASS_VALUE_TYPE_UDT) &&
+                cass_data_type_sub_type_count(data_type) == StructType::GetChildCount(type)) {
+                auto encoder = MakeEncoder(data_type, EncodeValues,
+                                           cass_type == CASS_VALUE_TYPE_TUPLE ? EncodeTupleValue : EncodeUserTypeValue);
+                for (idx_t i = 0; i < StructType::GetChildCount(type); i++) {
+                    encoder.children.push_back(
+                        GetEncoder(cass_data_type_sub_data_type(data_type, i), StructType::GetChildType(type, i)));
+                }
+                return encoder;
+            }
+            break;
+        default:
+            break;
+    }
+    throw NotImplementedException("Cannot write %s values to a Cassandra %s column", type.ToString(),
+                                  CassandraTypeMapper::GetCassandraTypeName(cass_type));
+}
+
+bool CassandraEncoder::SerializeKeyComponent(const CassandraColumnEncoder &encoder, const UnifiedVectorFormat &format,
+                                             idx_t idx, bool composite, string &key) {
+    if (!encoder.serialize) {
+        return false;
+    }
+    if (!composite) {
+        return encoder.serialize(encoder, format, idx, key);
+    }
+    string component;
+    if (!encoder.serialize(encoder, format, idx, component) || component.size() > NumericLimits<uint16_t>::Maximum()) {
+        return false;
+    }
+    AppendBigEndian(key, static_cast<uint16_t>(component.size()));
+    key += component;
+    key += '\0';
+    return true;
+}
+
+} // namespace cassandra
+} // namespace duckdb
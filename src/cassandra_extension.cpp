@@ -7,8 +7,12 @@
 #include "duckdb/function/scalar_function.hpp"
 
 #include "cassandra_attach.hpp"
+#include "cassandra_cache_stats.hpp"
 #include "cassandra_client.hpp"
+#include "cassandra_copy.hpp"
 #include "cassandra_extension.hpp"
+#include "cassandra_functions.hpp"
+#include "cassandra_optimizer.hpp"
 #include "cassandra_scan.hpp"
 #include "cassandra_settings.hpp"
 #include "cassandra_utils.hpp"
@@ -27,9 +31,33 @@ static void LoadInternal(ExtensionLoader &loader) {
     cassandra::CassandraQueryFunction cassandra_query_function;
     loader.RegisterFunction(cassandra_query_function);
 
+    cassandra::CassandraPreparedCacheStatsFunction cassandra_prepared_cache_stats_function;
+    loader.RegisterFunction(cassandra_prepared_cache_stats_function);
+
+    // Token, key serialization and type mapping as the extension computes them
+    cassandra::CassandraTokenFunction cassandra_token_function;
+    loader.RegisterFunction(cassandra_token_function);
+
+    cassandra::CassandraSerializeKeyFunction cassandra_serialize_key_function;
+    loader.RegisterFunction(cassandra_serialize_key_function);
+
+    cassandra::CassandraTokenRangesFunction cassandra_token_ranges_function;
+    loader.RegisterFunction(cassandra_token_ranges_function);
+
+    cassandra::CassandraTypeFunction cassandra_type_function;
+    loader.RegisterFunction(cassandra_type_function);
+
+    cassandra::CassandraCQLTypeFunction cassandra_cql_type_function;
+    loader.RegisterFunction(cassandra_cql_type_function);
+
+    // COPY ... TO 'keyspace.table' (FORMAT cassandra)
+    cassandra::CassandraCopyFunction cassandra_copy_function;
+    loader.RegisterFunction(cassandra_copy_function);
+
     auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
     auto storage_ext = make_uniq<cassandra::CassandraStorageExtension>();
     config.storage_extensions["cassandra"] = std::move(storage_ext);
+    config.optimizer_extensions.push_back(cassandra::CassandraOptimizer::GetExtension());
     config.AddExtensionOption("cassandra_contact_points",
                               "Comma-separated list of Cassandra contact points",
                               LogicalType::VARCHAR,
@@ -89,6 +117,97 @@ static void LoadInternal(ExtensionLoader &loader) {
                               LogicalType::VARCHAR,
                               Value(""),
                               cassandra::CassandraSettings::SetUserCertHex);
+    
+    // Driver tuning, read by cassandra_scan, cassandra_query and ATTACH. 0 keeps the driver default.
+    config.AddExtensionOption("cassandra_serial_consistency",
+                              "Serial consistency level of conditional writes",
+                              LogicalType::VARCHAR,
+                              Value(""));
+    
+    config.AddExtensionOption("cassandra_io_threads",
+                              "Number of driver IO threads",
+                              LogicalType::INTEGER,
+                              Value(0));
+    
+    config.AddExtensionOption("cassandra_core_connections",
+                              "Connections opened per host and IO thread",
+                              LogicalType::INTEGER,
+                              Value(0));
+    
+    config.AddExtensionOption("cassandra_queue_size",
+                              "Requests queued per IO thread before new ones are rejected",
+                              LogicalType::INTEGER,
+                              Value(0));
+    
+    config.AddExtensionOption("cassandra_request_timeout",
+                              "Request timeout in milliseconds",
+                              LogicalType::INTEGER,
+                              Value(0));
+    
+    config.AddExtensionOption("cassandra_connect_timeout",
+                              "Connect timeout in milliseconds",
+                              LogicalType::INTEGER,
+                              Value(0));
+    
+    config.AddExtensionOption("cassandra_tcp_nodelay",
+                              "Disable Nagle's algorithm on driver connections",
+                              LogicalType::BOOLEAN,
+                              Value(true));
+    
+    config.AddExtensionOption("cassandra_tcp_keepalive",
+                              "TCP keepalive delay in seconds (0 = off)",
+                              LogicalType::INTEGER,
+                              Value(0));
+    
+    config.AddExtensionOption("cassandra_coalesce_delay",
+                              "Microseconds the driver waits to coalesce writes (-1 = driver default)",
+                              LogicalType::BIGINT,
+                              Value::BIGINT(-1));
+    
+    config.AddExtensionOption("cassandra_page_size",
+                              "Rows fetched per page",
+                              LogicalType::INTEGER,
+                              Value(5000));
+    
+    config.AddExtensionOption("cassandra_local_dc",
+                              "Data center whose nodes coordinate requests",
+                              LogicalType::VARCHAR,
+                              Value(""));
+    
+    config.AddExtensionOption("cassandra_token_aware",
+                              "Send requests to a replica of the data they read",
+                              LogicalType::BOOLEAN,
+                              Value(true));
+    
+    config.AddExtensionOption("cassandra_write_concurrency",
+                              "Write requests kept in flight per statement",
+                              LogicalType::INTEGER,
+                              Value(256));
+    
+    config.AddExtensionOption("cassandra_write_batch_size",
+                              "Rows of one partition sent as a single UNLOGGED batch",
+                              LogicalType::INTEGER,
+                              Value(16));
+    
+    config.AddExtensionOption("cassandra_write_retries",
+                              "Retries of a write request that timed out or found no replica",
+                              LogicalType::INTEGER,
+                              Value(3));
+    
+    config.AddExtensionOption("cassandra_write_rate",
+                              "Rows written per second by one statement (0 = unlimited)",
+                              LogicalType::BIGINT,
+                              Value::BIGINT(0));
+    
+    config.AddExtensionOption("cassandra_partition_key",
+                              "Comma-separated partition key columns of tables created with CREATE TABLE AS",
+                              LogicalType::VARCHAR,
+                              Value());
+    
+    config.AddExtensionOption("cassandra_clustering_key",
+                              "Clustering columns of tables created with CREATE TABLE AS, each optionally ASC or DESC",
+                              LogicalType::VARCHAR,
+                              Value());
 }
 
 void CassandraExtension::Load(ExtensionLoader &loader) {
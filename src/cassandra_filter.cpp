@@ -0,0 +1,383 @@
+#include "cassandra_filter.hpp"
+#include "cassandra_scan.hpp"
+#include "cassandra_types.hpp"
+#include "cassandra_utils.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/common/types/value_map.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+namespace cassandra {
+
+namespace {
+
+// A filter on a single key column: EQUAL, IN or one side of a range
+struct KeyPredicate {
+    idx_t filter_index;
+    string column_name;
+    ExpressionType comparison;
+    vector<Value> values;
+};
+
+// All translatable predicates on one key column
+struct KeyRestriction {
+    const KeyPredicate* equality = nullptr;
+    const KeyPredicate* lower = nullptr;
+    const KeyPredicate* upper = nullptr;
+};
+
+bool IsRangeComparison(ExpressionType type) {
+    return type == ExpressionType::COMPARE_GREATERTHAN || type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
+           type == ExpressionType::COMPARE_LESSTHAN || type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+}
+
+// DuckDB type a key column must have for its CQL type to be pushed down
+bool IsPushableType(const string &cql_type, const LogicalType &type) {
+    static const unordered_map<string, LogicalTypeId> pushable_types = {
+        {"ascii", LogicalTypeId::VARCHAR},     {"text", LogicalTypeId::VARCHAR},
+        {"varchar", LogicalTypeId::VARCHAR},   {"boolean", LogicalTypeId::BOOLEAN},
+        {"tinyint", LogicalTypeId::TINYINT},   {"smallint", LogicalTypeId::SMALLINT},
+        {"int", LogicalTypeId::INTEGER},       {"bigint", LogicalTypeId::BIGINT},
+        {"float", LogicalTypeId::FLOAT},       {"double", LogicalTypeId::DOUBLE},
+        {"timestamp", LogicalTypeId::TIMESTAMP_TZ}, {"date", LogicalTypeId::DATE},
+        {"time", LogicalTypeId::TIME},         {"uuid", LogicalTypeId::UUID},
+        {"timeuuid", LogicalTypeId::UUID},     {"blob", LogicalTypeId::BLOB}};
+    auto entry = pushable_types.find(cql_type);
+    return entry != pushable_types.end() && entry->second == type.id();
+}
+
+// Convert a DuckDB constant into the value bound to the CQL parameter. Returns false when the
+// comparison cannot be expressed exactly on the Cassandra side.
+bool ConvertValue(ExpressionType comparison, const Value &value, Value &result) {
+    if (value.IsNull()) {
+        return false;
+    }
+    switch (value.type().id()) {
+    case LogicalTypeId::UUID:
+        // Cassandra orders (time)uuids differently from DuckDB, only equality is safe
+        if (IsRangeComparison(comparison)) {
+            return false;
+        }
+        result = value;
+        return true;
+    case LogicalTypeId::TIMESTAMP_TZ: {
+        // Cassandra stores milliseconds, so every stored value is a whole millisecond. Rounding the
+        // bound in the right direction keeps the range exact.
+        auto micros = value.GetValueUnsafe<timestamp_t>().value;
+        auto millis = micros / Interval::MICROS_PER_MSEC;
+        auto remainder = micros % Interval::MICROS_PER_MSEC;
+        if (remainder < 0) {
+            millis--;
+            remainder += Interval::MICROS_PER_MSEC;
+        }
+        if (remainder != 0) {
+            switch (comparison) {
+            case ExpressionType::COMPARE_GREATERTHAN:
+            case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+                break;
+            case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+            case ExpressionType::COMPARE_LESSTHAN:
+                millis++;
+                break;
+            default:
+                // Equality with a sub-millisecond timestamp never matches, leave it to DuckDB
+                return false;
+            }
+        }
+        result = Value::BIGINT(millis);
+        return true;
+    }
+    case LogicalTypeId::DATE:
+        // Cassandra dates are unsigned days with the epoch at 2^31
+        result = Value::UINTEGER(static_cast<uint32_t>(static_cast<int64_t>(value.GetValueUnsafe<date_t>().days) + (1LL << 31)));
+        return true;
+    case LogicalTypeId::TIME: {
+        // Cassandra time is nanoseconds since midnight, read back truncated to microseconds. The
+        // bound covers every nanosecond of the microsecond, so the range stays exact.
+        auto nanos = value.GetValueUnsafe<dtime_t>().micros * 1000;
+        switch (comparison) {
+        case ExpressionType::COMPARE_GREATERTHAN:
+        case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+            nanos += 999;
+            break;
+        case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+        case ExpressionType::COMPARE_LESSTHAN:
+            break;
+        default:
+            // Equality would be a range of a thousand nanoseconds, leave it to DuckDB
+            return false;
+        }
+        result = Value::BIGINT(nanos);
+        return true;
+    }
+    default:
+        result = value;
+        return true;
+    }
+}
+
+// Column name referenced by expr if it is a column of this scan
+bool GetColumnName(const Expression &expr, const LogicalGet &get, const CassandraScanBindData &bind_data,
+                   string &column_name) {
+    if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+        return false;
+    }
+    auto &colref = expr.Cast<BoundColumnRefExpression>();
+    if (colref.binding.table_index != get.table_index) {
+        return false;
+    }
+    auto &column_ids = get.GetColumnIds();
+    if (colref.binding.column_index >= column_ids.size()) {
+        return false;
+    }
+    auto column_id = column_ids[colref.binding.column_index].GetPrimaryIndex();
+    if (column_id >= bind_data.column_names.size()) {
+        return false;
+    }
+    column_name = bind_data.column_names[column_id];
+    auto key_type = bind_data.key_types.find(column_name);
+    return key_type != bind_data.key_types.end() && IsPushableType(key_type->second, colref.return_type);
+}
+
+// Recognize "key op constant", "constant op key" and "key IN (constants)"
+bool ParsePredicate(const Expression &expr, idx_t filter_index, const LogicalGet &get,
+                    const CassandraScanBindData &bind_data, KeyPredicate &result) {
+    result.filter_index = filter_index;
+    if (expr.GetExpressionClass() == ExpressionClass::BOUND_COMPARISON) {
+        auto &comparison = expr.Cast<BoundComparisonExpression>();
+        auto type = expr.GetExpressionType();
+        if (type != ExpressionType::COMPARE_EQUAL && !IsRangeComparison(type)) {
+            return false;
+        }
+        const Expression* column = comparison.left.get();
+        const Expression* constant = comparison.right.get();
+        if (column->GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+            std::swap(column, constant);
+            type = FlipComparisonExpression(type);
+        }
+        if (constant->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT ||
+            !GetColumnName(*column, get, bind_data, result.column_name)) {
+            return false;
+        }
+        auto &value = constant->Cast<BoundConstantExpression>().value;
+        if (value.type() != column->return_type) {
+            return false;
+        }
+        Value converted;
+        if (!ConvertValue(type, value, converted)) {
+            return false;
+        }
+        result.comparison = type;
+        result.values.push_back(std::move(converted));
+        return true;
+    }
+    if (expr.GetExpressionType() == ExpressionType::COMPARE_IN) {
+        auto &in_expr = expr.Cast<BoundOperatorExpression>();
+        if (in_expr.children.size() < 2 || !GetColumnName(*in_expr.children[0], get, bind_data, result.column_name)) {
+            return false;
+        }
+        for (idx_t i = 1; i < in_expr.children.size(); i++) {
+            auto &child = *in_expr.children[i];
+            if (child.GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+                return false;
+            }
+            auto &value = child.Cast<BoundConstantExpression>().value;
+            Value converted;
+            if (value.type() != in_expr.children[0]->return_type ||
+                !ConvertValue(ExpressionType::COMPARE_EQUAL, value, converted)) {
+                return false;
+            }
+            result.values.push_back(std::move(converted));
+        }
+        result.comparison = ExpressionType::COMPARE_IN;
+        return true;
+    }
+    return false;
+}
+
+const char* ComparisonOperator(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::COMPARE_EQUAL:
+        return " = ";
+    case ExpressionType::COMPARE_GREATERTHAN:
+        return " > ";
+    case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+        return " >= ";
+    case ExpressionType::COMPARE_LESSTHAN:
+        return " < ";
+    case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+        return " <= ";
+    default:
+        throw InternalException("Unsupported comparison in Cassandra filter pushdown");
+    }
+}
+
+} // namespace
+
+void CassandraFilterPushdown::PushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                                    vector<unique_ptr<Expression>> &filters) {
+    auto &bind_data = bind_data_p->Cast<CassandraScanBindData>();
+    if (bind_data.partition_key.empty() || !bind_data.filter_condition.empty()) {
+        return;
+    }
+
+    vector<KeyPredicate> predicates;
+    for (idx_t i = 0; i < filters.size(); i++) {
+        KeyPredicate predicate;
+        if (ParsePredicate(*filters[i], i, get, bind_data, predicate)) {
+            predicates.push_back(std::move(predicate));
+        }
+    }
+
+    // CQL accepts a single equality and at most one bound on each side per column
+    unordered_map<string, KeyRestriction> restrictions;
+    for (auto &predicate : predicates) {
+        auto &restriction = restrictions[predicate.column_name];
+        switch (predicate.comparison) {
+        case ExpressionType::COMPARE_EQUAL:
+        case ExpressionType::COMPARE_IN:
+            if (!restriction.equality) {
+                restriction.equality = &predicate;
+            }
+            break;
+        case ExpressionType::COMPARE_GREATERTHAN:
+        case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+            if (!restriction.lower) {
+                restriction.lower = &predicate;
+            }
+            break;
+        default:
+            if (!restriction.upper) {
+                restriction.upper = &predicate;
+            }
+            break;
+        }
+    }
+
+    // Without every partition key column restricted Cassandra would need ALLOW FILTERING
+    vector<const KeyPredicate*> pushed;
+    for (auto &column : bind_data.partition_key) {
+        auto entry = restrictions.find(column);
+        if (entry == restrictions.end() || !entry->second.equality) {
+            return;
+        }
+        pushed.push_back(entry->second.equality);
+    }
+    // Clustering columns can be restricted as a prefix: equalities followed by one IN or range
+    idx_t fixed_clustering_columns = 0;
+    for (auto &column : bind_data.clustering_key) {
+        auto entry = restrictions.find(column);
+        if (entry == restrictions.end()) {
+            break;
+        }
+        auto &restriction = entry->second;
+        if (restriction.equality) {
+            pushed.push_back(restriction.equality);
+            fixed_clustering_columns++;
+            if (restriction.equality->comparison == ExpressionType::COMPARE_IN) {
+                break;
+            }
+            continue;
+        }
+        if (restriction.lower) {
+            pushed.push_back(restriction.lower);
+        }
+        if (restriction.upper) {
+            pushed.push_back(restriction.upper);
+        }
+        break;
+    }
+
+    string condition;
+    vector<Value> params;
+    vector<idx_t> pushed_filters;
+    // Keys addressed by the equalities and IN lists, all of them once the whole key is fixed
+    idx_t key_count = 1;
+    for (auto predicate : pushed) {
+        if (predicate->comparison == ExpressionType::COMPARE_EQUAL ||
+            predicate->comparison == ExpressionType::COMPARE_IN) {
+            value_set_t distinct(predicate->values.begin(), predicate->values.end());
+            key_count *= distinct.size();
+        }
+        condition += condition.empty() ? "" : " AND ";
+        condition += QuoteCQLIdentifier(predicate->column_name);
+        if (predicate->comparison == ExpressionType::COMPARE_IN) {
+            condition += " IN (";
+            for (idx_t i = 0; i < predicate->values.size(); i++) {
+                condition += i > 0 ? ", ?" : "?";
+            }
+            condition += ")";
+        } else {
+            condition += ComparisonOperator(predicate->comparison);
+            condition += "?";
+        }
+        params.insert(params.end(), predicate->values.begin(), predicate->values.end());
+        pushed_filters.push_back(predicate->filter_index);
+    }
+    bind_data.filter_condition = condition;
+    bind_data.filter_params = std::move(params);
+    bind_data.filter_fixes_primary_key = fixed_clustering_columns == bind_data.clustering_key.size();
+    bind_data.filter_key_count = bind_data.filter_fixes_primary_key ? key_count : 0;
+
+    // Cassandra now evaluates these filters exactly, drop them from the plan
+    std::sort(pushed_filters.begin(), pushed_filters.end());
+    for (idx_t i = pushed_filters.size(); i > 0; i--) {
+        filters.erase_at(pushed_filters[i - 1]);
+    }
+}
+
+void CassandraFilterPushdown::BindParameters(CassStatement* statement, const vector<Value> &params, idx_t offset) {
+    for (idx_t i = 0; i < params.size(); i++) {
+        auto &value = params[i];
+        auto index = offset + i;
+        switch (value.type().id()) {
+        case LogicalTypeId::BOOLEAN:
+            cass_statement_bind_bool(statement, index, BooleanValue::Get(value) ? cass_true : cass_false);
+            break;
+        case LogicalTypeId::TINYINT:
+            cass_statement_bind_int8(statement, index, TinyIntValue::Get(value));
+            break;
+        case LogicalTypeId::SMALLINT:
+            cass_statement_bind_int16(statement, index, SmallIntValue::Get(value));
+            break;
+        case LogicalTypeId::INTEGER:
+            cass_statement_bind_int32(statement, index, IntegerValue::Get(value));
+            break;
+        case LogicalTypeId::BIGINT:
+            cass_statement_bind_int64(statement, index, BigIntValue::Get(value));
+            break;
+        case LogicalTypeId::UINTEGER:
+            cass_statement_bind_uint32(statement, index, UIntegerValue::Get(value));
+            break;
+        case LogicalTypeId::FLOAT:
+            cass_statement_bind_float(statement, index, FloatValue::Get(value));
+            break;
+        case LogicalTypeId::DOUBLE:
+            cass_statement_bind_double(statement, index, DoubleValue::Get(value));
+            break;
+        case LogicalTypeId::VARCHAR: {
+            auto &str = StringValue::Get(value);
+            cass_statement_bind_string_n(statement, index, str.c_str(), str.size());
+            break;
+        }
+        case LogicalTypeId::BLOB: {
+            auto &str = StringValue::Get(value);
+            cass_statement_bind_bytes(statement, index, reinterpret_cast<const cass_byte_t*>(str.c_str()), str.size());
+            break;
+        }
+        case LogicalTypeId::UUID: {
+            cass_statement_bind_uuid(statement, index, CassandraTypeMapper::HugeintToUUID(value.GetValueUnsafe<hugeint_t>()));
+            break;
+        }
+        default:
+            throw InternalException("Cannot bind %s value to a Cassandra statement", value.type().ToString());
+        }
+    }
+}
+
+} // namespace cassandra
+} // namespace duckdb
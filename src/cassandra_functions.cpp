@@ -0,0 +1,266 @@
+#include "cassandra_functions.hpp"
+#include "cassandra_encoder.hpp"
+#include "cassandra_token_ranges.hpp"
+#include "cassandra_types.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_binder.hpp"
+
+namespace duckdb {
+namespace cassandra {
+
+struct CassandraKeyBindData : public FunctionData {
+    vector<LogicalType> types;
+    // Driver types of the key components, the encoders point into them
+    vector<shared_ptr<CassDataType>> data_types;
+    vector<CassandraColumnEncoder> encoders;
+
+    unique_ptr<FunctionData> Copy() const override {
+        auto result = make_uniq<CassandraKeyBindData>();
+        result->types = types;
+        result->data_types = data_types;
+        result->encoders = encoders;
+        return std::move(result);
+    }
+
+    bool Equals(const FunctionData &other) const override {
+        return types == other.Cast<CassandraKeyBindData>().types;
+    }
+};
+
+static unique_ptr<FunctionData> CassandraKeyBind(ClientContext &context, ScalarFunction &bound_function,
+                                                 vector<unique_ptr<Expression>> &arguments) {
+    auto bind_data = make_uniq<CassandraKeyBindData>();
+    for (auto &argument : arguments) {
+        // Literals are typed the way they are passed to the function
+        auto type = ExpressionBinder::GetExpressionReturnType(*argument);
+        bind_data->types.push_back(type);
+        if (type.id() == LogicalTypeId::SQLNULL) {
+            // Every row is NULL, nothing is ever serialized
+            bind_data->data_types.push_back(nullptr);
+            bind_data->encoders.push_back(CassandraColumnEncoder());
+            continue;
+        }
+        if (type.IsNested()) {
+            throw BinderException("%s cannot serialize a partition key component of type %s",
+                                  bound_function.name, type.ToString());
+        }
+        // The column CREATE TABLE would make for the type, which is what the writer encodes into
+        auto cass_type = CassandraType::Parse(CassandraTypeMapper::ToCQLType(type, true));
+        shared_ptr<CassDataType> data_type(cass_data_type_new(cass_type.id), cass_data_type_free);
+        auto encoder = CassandraEncoder::GetEncoder(data_type.get(), type);
+        if (!encoder.serialize) {
+            throw BinderException("%s cannot serialize a partition key component of type %s",
+                                  bound_function.name, type.ToString());
+        }
+        bind_data->data_types.push_back(std::move(data_type));
+        bind_data->encoders.push_back(std::move(encoder));
+    }
+    return std::move(bind_data);
+}
+
+// Serialize the partition key of every row and hand it to OP, or set the row NULL if a
+// component is NULL
+template <class OP>
+static void CassandraKeyExecute(DataChunk &args, ExpressionState &state, Vector &result) {
+    auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+    auto &bind_data = func_expr.bind_info->Cast<CassandraKeyBindData>();
+    auto column_count = args.ColumnCount();
+    vector<UnifiedVectorFormat> formats(column_count);
+    for (idx_t col = 0; col < column_count; col++) {
+        args.data[col].ToUnifiedFormat(args.size(), formats[col]);
+    }
+    bool composite = column_count > 1;
+
+    result.SetVectorType(VectorType::FLAT_VECTOR);
+    auto result_data = FlatVector::GetData<typename OP::TYPE>(result);
+    string key;
+    for (idx_t row = 0; row < args.size(); row++) {
+        key.clear();
+        bool is_null = false;
+        for (idx_t col = 0; col < column_count; col++) {
+            auto idx = formats[col].sel->get_index(row);
+            if (!formats[col].validity.RowIsValid(idx)) {
+                is_null = true;
+                break;
+            }
+            if (!CassandraEncoder::SerializeKeyComponent(bind_data.encoders[col], formats[col], idx, composite, key)) {
+                throw InvalidInputException("Cannot serialize %s as a Cassandra partition key component",
+                                            args.data[col].GetValue(row).ToString());
+            }
+        }
+        if (is_null) {
+            FlatVector::SetNull(result, row, true);
+            continue;
+        }
+        result_data[row] = OP::Operation(key, result);
+    }
+    if (args.AllConstant()) {
+        result.SetVectorType(VectorType::CONSTANT_VECTOR);
+    }
+}
+
+struct CassandraTokenOp {
+    typedef int64_t TYPE;
+    static int64_t Operation(const string &key, Vector &result) {
+        return CassandraTokenRanges::GetToken(const_data_ptr_cast(key.data()), key.size());
+    }
+};
+
+struct CassandraSerializeKeyOp {
+    typedef string_t TYPE;
+    static string_t Operation(const string &key, Vector &result) {
+        return StringVector::AddStringOrBlob(result, key);
+    }
+};
+
+CassandraTokenFunction::CassandraTokenFunction()
+    : ScalarFunction("cassandra_token", {LogicalType::ANY}, LogicalType::BIGINT,
+                     CassandraKeyExecute<CassandraTokenOp>, CassandraKeyBind) {
+    varargs = LogicalType::ANY;
+    null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+}
+
+CassandraSerializeKeyFunction::CassandraSerializeKeyFunction()
+    : ScalarFunction("cassandra_serialize_key", {LogicalType::ANY}, LogicalType::BLOB,
+                     CassandraKeyExecute<CassandraSerializeKeyOp>, CassandraKeyBind) {
+    varargs = LogicalType::ANY;
+    null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+}
+
+struct CassandraTokenRangesBindData : public TableFunctionData {
+    vector<CassandraTokenRange> ranges;
+};
+
+struct CassandraTokenRangesState : public GlobalTableFunctionState {
+    idx_t offset = 0;
+};
+
+static LogicalType SizeEstimatesType() {
+    child_list_t<LogicalType> fields;
+    fields.push_back(make_pair("range_start", LogicalType::BIGINT));
+    fields.push_back(make_pair("range_end", LogicalType::BIGINT));
+    fields.push_back(make_pair("partitions_count", LogicalType::BIGINT));
+    fields.push_back(make_pair("mean_partition_size", LogicalType::BIGINT));
+    return LogicalType::LIST(LogicalType::STRUCT(std::move(fields)));
+}
+
+static unique_ptr<FunctionData> CassandraTokenRangesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+    if (input.inputs[0].IsNull() || BigIntValue::Get(input.inputs[0]) < 1) {
+        throw BinderException("cassandra_token_ranges needs a split count of at least 1");
+    }
+    auto split_count = NumericCast<idx_t>(BigIntValue::Get(input.inputs[0]));
+
+    vector<CassandraSizeEstimate> estimates;
+    auto entry = input.named_parameters.find("estimates");
+    if (entry != input.named_parameters.end() && !entry->second.IsNull()) {
+        for (auto &row : ListValue::GetChildren(entry->second)) {
+            if (row.IsNull()) {
+                throw BinderException("cassandra_token_ranges size estimates cannot be NULL");
+            }
+            auto &fields = StructValue::GetChildren(row);
+            for (auto &field : fields) {
+                if (field.IsNull()) {
+                    throw BinderException("cassandra_token_ranges size estimates cannot have NULL fields");
+                }
+            }
+            estimates.push_back({BigIntValue::Get(fields[0]), BigIntValue::Get(fields[1]),
+                                 BigIntValue::Get(fields[2]), BigIntValue::Get(fields[3])});
+        }
+    }
+
+    auto bind_data = make_uniq<CassandraTokenRangesBindData>();
+    bind_data->ranges = CassandraTokenRanges::Split(estimates, split_count);
+
+    names = {"range_start", "range_end"};
+    return_types = {LogicalType::BIGINT, LogicalType::BIGINT};
+    return std::move(bind_data);
+}
+
+static unique_ptr<GlobalTableFunctionState> CassandraTokenRangesInit(ClientContext &context,
+                                                                     TableFunctionInitInput &input) {
+    return make_uniq<CassandraTokenRangesState>();
+}
+
+static void CassandraTokenRangesExecute(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
+    auto &bind_data = data.bind_data->Cast<CassandraTokenRangesBindData>();
+    auto &state = data.global_state->Cast<CassandraTokenRangesState>();
+    auto starts = FlatVector::GetData<int64_t>(output.data[0]);
+    auto ends = FlatVector::GetData<int64_t>(output.data[1]);
+    idx_t count = 0;
+    while (state.offset < bind_data.ranges.size() && count < STANDARD_VECTOR_SIZE) {
+        auto &range = bind_data.ranges[state.offset++];
+        starts[count] = range.start;
+        ends[count] = range.end;
+        count++;
+    }
+    output.SetCardinality(count);
+}
+
+CassandraTokenRangesFunction::CassandraTokenRangesFunction()
+    : TableFunction("cassandra_token_ranges", {LogicalType::BIGINT}, CassandraTokenRangesExecute,
+                    CassandraTokenRangesBind, CassandraTokenRangesInit) {
+    named_parameters["estimates"] = SizeEstimatesType();
+}
+
+static string_t CassandraTypeToDuckDB(string_t cql_type, int32_t decimal_scale, Vector &result) {
+    auto type = CassandraTypeMapper::ToDuckDBType(CassandraType::Parse(cql_type.GetString()), decimal_scale);
+    return StringVector::AddString(result, type.ToString());
+}
+
+static void CassandraTypeExecute(DataChunk &args, ExpressionState &state, Vector &result) {
+    if (args.ColumnCount() == 1) {
+        UnaryExecutor::Execute<string_t, string_t>(
+            args.data[0], result, args.size(),
+            [&](string_t cql_type) { return CassandraTypeToDuckDB(cql_type, -1, result); });
+        return;
+    }
+    BinaryExecutor::Execute<string_t, int32_t, string_t>(
+        args.data[0], args.data[1], result, args.size(),
+        [&](string_t cql_type, int32_t decimal_scale) { return CassandraTypeToDuckDB(cql_type, decimal_scale, result); });
+}
+
+CassandraTypeFunction::CassandraTypeFunction() : ScalarFunctionSet("cassandra_type") {
+    // Without a scale decimals are read as their exact text, as scans do by default
+    AddFunction(ScalarFunction({LogicalType::VARCHAR}, LogicalType::VARCHAR, CassandraTypeExecute));
+    AddFunction(ScalarFunction({LogicalType::VARCHAR, LogicalType::INTEGER}, LogicalType::VARCHAR, CassandraTypeExecute));
+}
+
+struct CassandraCQLTypeBindData : public FunctionData {
+    string cql_type;
+
+    unique_ptr<FunctionData> Copy() const override {
+        auto result = make_uniq<CassandraCQLTypeBindData>();
+        result->cql_type = cql_type;
+        return std::move(result);
+    }
+
+    bool Equals(const FunctionData &other) const override {
+        return cql_type == other.Cast<CassandraCQLTypeBindData>().cql_type;
+    }
+};
+
+static unique_ptr<FunctionData> CassandraCQLTypeBind(ClientContext &context, ScalarFunction &bound_function,
+                                                     vector<unique_ptr<Expression>> &arguments) {
+    auto bind_data = make_uniq<CassandraCQLTypeBindData>();
+    bind_data->cql_type = CassandraTypeMapper::ToCQLType(ExpressionBinder::GetExpressionReturnType(*arguments[0]));
+    return std::move(bind_data);
+}
+
+static void CassandraCQLTypeExecute(DataChunk &args, ExpressionState &state, Vector &result) {
+    auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+    auto &bind_data = func_expr.bind_info->Cast<CassandraCQLTypeBindData>();
+    result.Reference(Value(bind_data.cql_type));
+}
+
+CassandraCQLTypeFunction::CassandraCQLTypeFunction()
+    : ScalarFunction("cassandra_cql_type", {LogicalType::ANY}, LogicalType::VARCHAR, CassandraCQLTypeExecute,
+                     CassandraCQLTypeBind) {
+    // Like typeof, the type of a NULL is still known
+    null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+}
+
+} // namespace cassandra
+} // namespace duckdb
@@ -0,0 +1,354 @@
+#include "cassandra_optimizer.hpp"
+#include "cassandra_scan.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/operator/logical_delete.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_limit.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_update.hpp"
+#include "duckdb/planner/operator/logical_window.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+namespace cassandra {
+
+namespace {
+
+CassandraScanBindData* GetCassandraScan(LogicalOperator &op) {
+    if (op.type != LogicalOperatorType::LOGICAL_GET) {
+        return nullptr;
+    }
+    auto &get = op.Cast<LogicalGet>();
+    if (get.function.name != "cassandra_scan" || !get.bind_data || !get.table_filters.filters.empty()) {
+        return nullptr;
+    }
+    return &get.bind_data->Cast<CassandraScanBindData>();
+}
+
+// Follow a column reference down through projections. On success op is the operator that
+// produces the returned binding; nullptr if the value is computed along the way.
+const BoundColumnRefExpression* ResolveColumn(const Expression &expr, LogicalOperator* &op) {
+    auto current = &expr;
+    while (true) {
+        if (current->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+            return nullptr;
+        }
+        auto &colref = current->Cast<BoundColumnRefExpression>();
+        if (op->type != LogicalOperatorType::LOGICAL_PROJECTION) {
+            return &colref;
+        }
+        auto &projection = op->Cast<LogicalProjection>();
+        if (colref.binding.table_index != projection.table_index) {
+            return nullptr;
+        }
+        current = projection.expressions[colref.binding.column_index].get();
+        op = projection.children[0].get();
+    }
+}
+
+// Whether Cassandra sorts a clustering column of cql_type the way DuckDB sorts what it reads.
+// (Time)uuids are sorted by time, inet and decimals may be read as text, floats differ in NaN.
+bool SortsLikeDuckDB(const string &cql_type) {
+    static const unordered_set<string> same_order = {"ascii", "text",   "varchar",   "boolean", "tinyint", "smallint",
+                                                     "int",   "bigint", "timestamp", "date",    "time",    "blob"};
+    return same_order.count(cql_type) > 0;
+}
+
+// Name of the cassandra_scan column expr reads, evaluated on top of op
+bool ResolveScanColumn(const Expression &expr, LogicalOperator* op, const CassandraScanBindData &bind_data,
+                       string &column_name) {
+    auto colref = ResolveColumn(expr, op);
+    if (!colref || GetCassandraScan(*op) != &bind_data) {
+        return false;
+    }
+    auto &get = op->Cast<LogicalGet>();
+    auto &column_ids = get.GetColumnIds();
+    if (colref->binding.table_index != get.table_index || colref->binding.column_index >= column_ids.size()) {
+        return false;
+    }
+    auto column_id = column_ids[colref->binding.column_index].GetPrimaryIndex();
+    if (column_id >= bind_data.column_names.size()) {
+        return false;
+    }
+    column_name = bind_data.column_names[column_id];
+    return true;
+}
+
+void CollectConjuncts(const Expression &expr, vector<const Expression*> &result) {
+    if (expr.GetExpressionType() == ExpressionType::CONJUNCTION_AND) {
+        for (auto &child : expr.Cast<BoundConjunctionExpression>().children) {
+            CollectConjuncts(*child, result);
+        }
+        return;
+    }
+    result.push_back(&expr);
+}
+
+// Recognize "rn <= N", "rn < N" and "rn = 1" and return the reference and N
+const Expression* GetRowNumberBound(const Expression &expr, idx_t &limit) {
+    if (expr.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+        return nullptr;
+    }
+    auto &comparison = expr.Cast<BoundComparisonExpression>();
+    auto type = expr.GetExpressionType();
+    const Expression* column = comparison.left.get();
+    const Expression* constant = comparison.right.get();
+    if (column->GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+        std::swap(column, constant);
+        type = FlipComparisonExpression(type);
+    }
+    if (constant->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+        return nullptr;
+    }
+    auto &value = constant->Cast<BoundConstantExpression>().value;
+    if (value.IsNull() || !value.type().IsIntegral()) {
+        return nullptr;
+    }
+    auto bound = value.GetValue<int64_t>();
+    switch (type) {
+    case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+        break;
+    case ExpressionType::COMPARE_LESSTHAN:
+        bound--;
+        break;
+    case ExpressionType::COMPARE_EQUAL:
+        if (bound != 1) {
+            return nullptr;
+        }
+        break;
+    default:
+        return nullptr;
+    }
+    if (bound < 1) {
+        return nullptr;
+    }
+    limit = NumericCast<idx_t>(bound);
+    return column;
+}
+
+// row_number() OVER (PARTITION BY <partition key> ORDER BY <clustering prefix>) numbers rows in the
+// order Cassandra stores them within a partition, so "rn <= N" is exactly PER PARTITION LIMIT N
+void PushPerPartitionLimit(LogicalFilter &filter) {
+    vector<const Expression*> conjuncts;
+    for (auto &expr : filter.expressions) {
+        CollectConjuncts(*expr, conjuncts);
+    }
+    for (auto conjunct : conjuncts) {
+        idx_t limit;
+        auto row_number = GetRowNumberBound(*conjunct, limit);
+        if (!row_number) {
+            continue;
+        }
+        LogicalOperator* op = filter.children[0].get();
+        auto colref = ResolveColumn(*row_number, op);
+        if (!colref || op->type != LogicalOperatorType::LOGICAL_WINDOW) {
+            continue;
+        }
+        auto &window = op->Cast<LogicalWindow>();
+        if (colref->binding.table_index != window.window_index) {
+            continue;
+        }
+        auto &window_expr = window.expressions[colref->binding.column_index]->Cast<BoundWindowExpression>();
+        if (window_expr.GetExpressionType() != ExpressionType::WINDOW_ROW_NUMBER || window_expr.filter_expr ||
+            !window_expr.arg_orders.empty()) {
+            continue;
+        }
+
+        // Find the scan below the window
+        LogicalOperator* scan = window.children[0].get();
+        while (scan->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+            scan = scan->children[0].get();
+        }
+        auto bind_data = GetCassandraScan(*scan);
+        if (!bind_data || bind_data->partition_key.empty()) {
+            continue;
+        }
+
+        // PARTITION BY must be exactly the partition key
+        unordered_set<string> partitions;
+        bool matches = true;
+        for (auto &partition : window_expr.partitions) {
+            string column_name;
+            if (!ResolveScanColumn(*partition, window.children[0].get(), *bind_data, column_name)) {
+                matches = false;
+                break;
+            }
+            partitions.insert(column_name);
+        }
+        if (!matches || partitions.size() != bind_data->partition_key.size()) {
+            continue;
+        }
+        for (auto &column : bind_data->partition_key) {
+            matches = matches && partitions.count(column) > 0;
+        }
+
+        // ORDER BY must follow the stored clustering order
+        if (window_expr.orders.size() > bind_data->clustering_key.size()) {
+            matches = false;
+        }
+        for (idx_t i = 0; matches && i < window_expr.orders.size(); i++) {
+            auto &order = window_expr.orders[i];
+            string column_name;
+            if (!ResolveScanColumn(*order.expression, window.children[0].get(), *bind_data, column_name) ||
+                column_name != bind_data->clustering_key[i]) {
+                matches = false;
+                break;
+            }
+            // Otherwise Cassandra's first rows of a partition are not those DuckDB ranks first
+            auto key_type = bind_data->key_types.find(column_name);
+            if (key_type == bind_data->key_types.end() || !SortsLikeDuckDB(key_type->second)) {
+                matches = false;
+                break;
+            }
+            bool descending = order.type == OrderType::DESCENDING;
+            matches = descending == bind_data->clustering_descending[i];
+        }
+        if (!matches) {
+            continue;
+        }
+        if (bind_data->per_partition_limit == 0 || limit < bind_data->per_partition_limit) {
+            bind_data->per_partition_limit = limit;
+        }
+    }
+}
+
+// Cassandra rows have no row id, so a DELETE or UPDATE addresses the rows it modifies by their
+// primary key. The key columns of the scan are appended to the operator's expressions after
+// DuckDB's own, partition key first, and passed through the projection of an UPDATE.
+void AddPrimaryKeyColumns(LogicalOperator &op, TableCatalogEntry &table) {
+    if (table.catalog.GetCatalogType() != "cassandra") {
+        return;
+    }
+    LogicalOperator* child = op.children[0].get();
+    LogicalProjection* projection = nullptr;
+    if (op.type == LogicalOperatorType::LOGICAL_UPDATE) {
+        if (child->type != LogicalOperatorType::LOGICAL_PROJECTION) {
+            return;
+        }
+        projection = &child->Cast<LogicalProjection>();
+        child = child->children[0].get();
+    }
+    while (child->type == LogicalOperatorType::LOGICAL_FILTER) {
+        child = child->children[0].get();
+    }
+    auto bind_data = GetCassandraScan(*child);
+    if (!bind_data || bind_data->partition_key.empty()) {
+        return;
+    }
+    auto &get = child->Cast<LogicalGet>();
+    if (!get.projection_ids.empty()) {
+        return;
+    }
+
+    vector<idx_t> key_columns;
+    for (auto &name : bind_data->partition_key) {
+        auto entry = std::find(bind_data->column_names.begin(), bind_data->column_names.end(), name);
+        if (entry == bind_data->column_names.end()) {
+            return;
+        }
+        key_columns.push_back(NumericCast<idx_t>(entry - bind_data->column_names.begin()));
+    }
+    for (auto &name : bind_data->clustering_key) {
+        auto entry = std::find(bind_data->column_names.begin(), bind_data->column_names.end(), name);
+        if (entry == bind_data->column_names.end()) {
+            return;
+        }
+        key_columns.push_back(NumericCast<idx_t>(entry - bind_data->column_names.begin()));
+    }
+
+    for (auto column_id : key_columns) {
+        // Scan the column unless the statement already reads it
+        auto &column_ids = get.GetColumnIds();
+        idx_t index = column_ids.size();
+        for (idx_t i = 0; i < column_ids.size(); i++) {
+            if (column_ids[i].GetPrimaryIndex() == column_id) {
+                index = i;
+                break;
+            }
+        }
+        if (index == column_ids.size()) {
+            get.AddColumnId(column_id);
+        }
+        auto &name = bind_data->column_names[column_id];
+        auto &type = bind_data->column_types[column_id];
+        auto binding = ColumnBinding(get.table_index, index);
+        unique_ptr<Expression> key = make_uniq<BoundColumnRefExpression>(name, type, binding);
+        if (projection) {
+            projection->expressions.push_back(std::move(key));
+            binding = ColumnBinding(projection->table_index, projection->expressions.size() - 1);
+            key = make_uniq<BoundColumnRefExpression>(name, type, binding);
+        }
+        op.expressions.push_back(std::move(key));
+    }
+}
+
+void PreOptimizeRecursive(LogicalOperator &op) {
+    if (op.type == LogicalOperatorType::LOGICAL_FILTER) {
+        PushPerPartitionLimit(op.Cast<LogicalFilter>());
+    }
+    if (op.type == LogicalOperatorType::LOGICAL_DELETE) {
+        AddPrimaryKeyColumns(op, op.Cast<LogicalDelete>().table);
+    }
+    if (op.type == LogicalOperatorType::LOGICAL_UPDATE) {
+        AddPrimaryKeyColumns(op, op.Cast<LogicalUpdate>().table);
+    }
+    for (auto &child : op.children) {
+        PreOptimizeRecursive(*child);
+    }
+}
+
+void OptimizeRecursive(LogicalOperator &op) {
+    if (op.type == LogicalOperatorType::LOGICAL_LIMIT) {
+        auto &limit = op.Cast<LogicalLimit>();
+        auto offset_type = limit.offset_val.Type();
+        if (limit.limit_val.Type() == LimitNodeType::CONSTANT_VALUE &&
+            (offset_type == LimitNodeType::UNSET || offset_type == LimitNodeType::CONSTANT_VALUE)) {
+            // Projections keep the row count, anything else in between would change it
+            LogicalOperator* scan = limit.children[0].get();
+            while (scan->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+                scan = scan->children[0].get();
+            }
+            auto bind_data = GetCassandraScan(*scan);
+            if (bind_data) {
+                idx_t row_limit = limit.limit_val.GetConstantValue();
+                if (offset_type == LimitNodeType::CONSTANT_VALUE) {
+                    row_limit += limit.offset_val.GetConstantValue();
+                }
+                // The LIMIT stays in the plan, Cassandra just stops sending rows early
+                if (row_limit > 0 && row_limit < NumericLimits<int32_t>::Maximum()) {
+                    bind_data->limit = row_limit;
+                }
+            }
+        }
+    }
+    for (auto &child : op.children) {
+        OptimizeRecursive(*child);
+    }
+}
+
+} // namespace
+
+OptimizerExtension CassandraOptimizer::GetExtension() {
+    OptimizerExtension extension;
+    extension.pre_optimize_function = PreOptimize;
+    extension.optimize_function = Optimize;
+    return extension;
+}
+
+void CassandraOptimizer::PreOptimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+    PreOptimizeRecursive(*plan);
+}
+
+void CassandraOptimizer::Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+    OptimizeRecursive(*plan);
+}
+
+} // namespace cassandra
+} // namespace duckdb
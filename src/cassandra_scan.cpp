@@ -1,34 +1,260 @@
 #include "cassandra_scan.hpp"
 #include "cassandra_client.hpp"
+#include "cassandra_client_pool.hpp"
 #include "cassandra_utils.hpp"
 #include "cassandra_types.hpp"
-#include "duckdb/common/types/uuid.hpp"
-#include "duckdb/common/types/timestamp.hpp"
+#include "cassandra_decoder.hpp"
+#include "cassandra_filter.hpp"
+#include "cassandra_settings.hpp"
 #include "duckdb/common/shared_ptr.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <algorithm>
 
 namespace duckdb {
 namespace cassandra {
 
 // CassandraScanBindData is now defined in cassandra_scan.hpp
 
+// Streams the rows of a single statement page by page. As soon as a page arrives
+// the request for the following page is sent, so the stream holds at most two
+// pages: the one being decoded and the one in flight. Zero-copy string vectors
+// may keep a page alive a little longer through CassandraPageBuffer.
+class CassandraResultStream {
+public:
+    CassandraResultStream(CassandraClient &client, CassStatement* statement)
+        : client(client), statement(statement), pending_page(nullptr), iterator(nullptr) {
+        Request();
+    }
+    
+    // Continue a statement whose first page was already fetched, e.g. by cassandra_query's bind
+    CassandraResultStream(CassandraClient &client, CassStatement* statement, shared_ptr<const CassResult> first_page)
+        : client(client), statement(statement), pending_page(nullptr), iterator(nullptr) {
+        SetPage(std::move(first_page));
+    }
+    
+    ~CassandraResultStream() {
+        if (pending_page) {
+            cass_future_wait(pending_page);
+            cass_future_free(pending_page);
+        }
+        ReleasePage();
+        cass_statement_free(statement);
+    }
+    
+    // Fetches up to max_rows rows, all belonging to the current page. The rows stay
+    // valid until the next call. Returns 0 once every page has been consumed.
+    idx_t Fetch(const CassRow** rows, idx_t max_rows) {
+        while (true) {
+            if (!iterator && !ReceivePage()) {
+                return 0;
+            }
+            idx_t count = 0;
+            while (count < max_rows && cass_iterator_next(iterator)) {
+                rows[count++] = cass_iterator_get_row(iterator);
+            }
+            if (count > 0) {
+                return count;
+            }
+            // Current page is exhausted, move on to the prefetched one
+            ReleasePage();
+        }
+    }
+    
+    const shared_ptr<const CassResult> &CurrentPage() const {
+        return result;
+    }
+
+private:
+    // Send the statement for the next page. Every page goes through the current session, so a
+    // stream carries on over a reconnect; the session is held until the page has arrived.
+    void Request() {
+        pending_session = client.GetSession();
+        pending_page = cass_session_execute(pending_session.get(), statement);
+    }
+    
+    bool ReceivePage() {
+        if (!pending_page) {
+            return false;
+        }
+        CassFuture* future = pending_page;
+        pending_page = nullptr;
+        auto error_code = cass_future_error_code(future);
+        pending_session.reset();
+        if (error_code != CASS_OK) {
+            auto message = CassandraClient::GetErrorMessage(future);
+            cass_future_free(future);
+            client.ReportError(error_code);
+            throw IOException("Cassandra query failed: %s", message);
+        }
+        shared_ptr<const CassResult> page(cass_future_get_result(future), cass_result_free);
+        cass_future_free(future);
+        SetPage(std::move(page));
+        return true;
+    }
+    
+    void SetPage(shared_ptr<const CassResult> page) {
+        result = std::move(page);
+        // Request the next page right away so the network round trip overlaps with decoding
+        if (cass_result_has_more_pages(result.get())) {
+            cass_statement_set_paging_state(statement, result.get());
+            Request();
+        }
+        iterator = cass_iterator_from_result(result.get());
+    }
+    
+    void ReleasePage() {
+        if (iterator) {
+            cass_iterator_free(iterator);
+            iterator = nullptr;
+        }
+        result.reset();
+    }
+    
+    CassandraClient &client;
+    CassStatement* statement;
+    // Session pending_page was sent through
+    shared_ptr<CassSession> pending_session;
+    CassFuture* pending_page;
+    shared_ptr<const CassResult> result;
+    CassIterator* iterator;
+};
+
 struct CassandraScanGlobalState : public GlobalTableFunctionState {
     shared_ptr<CassandraClient> client;
-    CassIterator* result_iterator;
-    const CassResult* result;
-    bool finished;
-    
-    CassandraScanGlobalState() : result_iterator(nullptr), result(nullptr), finished(false) {}
+    // Consistency, timeout and page size of every statement
+    CassandraConfig options;
+    // Statement text; with token ranges it ends in "token(pk) > ? AND token(pk) <= ?"
+    string query;
+    bool use_token_ranges;
+    // Values for the placeholders of the pushed down filter
+    vector<Value> params;
+    // For every output column the index of the CQL result column, INVALID_INDEX for virtual columns
+    vector<idx_t> projection;
+    // Decoder of every output column
+    vector<CassandraColumnDecoder> decoders;
+    // First page of the statement when bind already executed it
+    shared_ptr<const CassResult> first_page;
+    // Splits of the scan, claimed by the worker threads one at a time
+    vector<CassandraTokenRange> ranges;
+    atomic<idx_t> next_range;
+    
+    CassandraScanGlobalState() : use_token_ranges(false), next_range(0) {}
+    
+    idx_t MaxThreads() const override {
+        return MaxValue<idx_t>(ranges.size(), 1);
+    }
     
-    ~CassandraScanGlobalState() {
-        if (result_iterator) {
-            cass_iterator_free(result_iterator);
+    // Claim the next split and start streaming it, returns nullptr once all splits are taken
+    unique_ptr<CassandraResultStream> NextStream() {
+        idx_t index = next_range++;
+        if (index >= ranges.size()) {
+            return nullptr;
+        }
+        CassStatement* statement = client->NewStatement(query);
+        CassandraClient::ConfigureStatement(statement, options);
+        if (use_token_ranges) {
+            cass_statement_bind_int64(statement, 0, ranges[index].start);
+            cass_statement_bind_int64(statement, 1, ranges[index].end);
+            // token() bounds carry no partition key for the driver to route by, so give it
+            // a routing key that hashes into the range
+            if (options.token_aware) {
+                auto routing_key = CassandraTokenRanges::GetRoutingKey(ranges[index]);
+                if (!routing_key.empty()) {
+                    cass_statement_set_routing_key(statement, routing_key.c_str(), routing_key.size());
+                }
+            }
+        } else {
+            // Bound partition key values route through the prepared statement's key indices
+            CassandraFilterPushdown::BindParameters(statement, params, 0);
         }
-        if (result) {
-            cass_result_free(result);
+        if (first_page) {
+            return make_uniq<CassandraResultStream>(*client, statement, std::move(first_page));
         }
+        return make_uniq<CassandraResultStream>(*client, statement);
     }
 };
 
+struct CassandraScanLocalState : public LocalTableFunctionState {
+    unique_ptr<CassandraResultStream> stream;
+    bool finished = false;
+};
+
+void CassandraScanBindData::BindDecoders() {
+    decoders.clear();
+    for (idx_t i = 0; i < column_types.size(); i++) {
+        auto cass_type = i < column_cass_types.size() ? column_cass_types[i] : CassandraType();
+        decoders.push_back(CassandraDecoder::GetDecoder(cass_type, column_types[i], zero_copy));
+    }
+}
+
+void CassandraScanBindData::LoadKeyColumns(const CassandraTableSchema &schema) {
+    partition_key = schema.partition_key;
+    clustering_key = schema.clustering_key;
+    clustering_descending = schema.clustering_descending;
+    key_types.clear();
+    for (idx_t i = 0; i < schema.column_names.size(); i++) {
+        auto &name = schema.column_names[i];
+        bool is_key = std::find(partition_key.begin(), partition_key.end(), name) != partition_key.end() ||
+                      std::find(clustering_key.begin(), clustering_key.end(), name) != clustering_key.end();
+        if (is_key) {
+            key_types[name] = CassandraTypeMapper::GetCassandraTypeName(schema.column_types[i].id);
+        }
+    }
+}
+
+// Consistency, driver tuning and routing parameters shared by cassandra_scan and cassandra_query
+static void ParseTuningParameter(const string &key, const Value &value, CassandraConfig &config) {
+    if (key == "consistency") {
+        config.consistency = StringValue::Get(value);
+    } else if (key == "serial_consistency") {
+        config.serial_consistency = StringValue::Get(value);
+    } else if (key == "io_threads") {
+        config.io_threads = IntegerValue::Get(value);
+    } else if (key == "core_connections") {
+        config.core_connections_per_host = IntegerValue::Get(value);
+    } else if (key == "queue_size") {
+        config.queue_size_io = IntegerValue::Get(value);
+    } else if (key == "request_timeout") {
+        config.request_timeout_ms = IntegerValue::Get(value);
+    } else if (key == "connect_timeout") {
+        config.connect_timeout_ms = IntegerValue::Get(value);
+    } else if (key == "tcp_nodelay") {
+        config.tcp_nodelay = BooleanValue::Get(value);
+    } else if (key == "tcp_keepalive") {
+        config.tcp_keepalive_secs = IntegerValue::Get(value);
+    } else if (key == "coalesce_delay") {
+        config.coalesce_delay_us = BigIntValue::Get(value);
+    } else if (key == "local_dc") {
+        config.local_dc = StringValue::Get(value);
+    } else if (key == "token_aware") {
+        config.token_aware = BooleanValue::Get(value);
+    } else if (key == "page_size") {
+        auto page_size = IntegerValue::Get(value);
+        if (page_size < 1) {
+            throw BinderException("page_size must be at least 1");
+        }
+        config.page_size = page_size;
+    }
+}
+
+static void AddTuningParameters(named_parameter_type_map_t &named_parameters) {
+    named_parameters["consistency"] = LogicalType::VARCHAR;
+    named_parameters["serial_consistency"] = LogicalType::VARCHAR;
+    named_parameters["io_threads"] = LogicalType::INTEGER;       // Driver IO threads
+    named_parameters["core_connections"] = LogicalType::INTEGER; // Connections per host and IO thread
+    named_parameters["queue_size"] = LogicalType::INTEGER;       // Requests queued per IO thread
+    named_parameters["request_timeout"] = LogicalType::INTEGER;  // Milliseconds
+    named_parameters["connect_timeout"] = LogicalType::INTEGER;  // Milliseconds
+    named_parameters["tcp_nodelay"] = LogicalType::BOOLEAN;
+    named_parameters["tcp_keepalive"] = LogicalType::INTEGER;    // Seconds, 0 = off
+    named_parameters["coalesce_delay"] = LogicalType::BIGINT;    // Microseconds, -1 = driver default
+    named_parameters["page_size"] = LogicalType::INTEGER;        // Rows per page
+    named_parameters["local_dc"] = LogicalType::VARCHAR;         // Data center of the coordinators
+    named_parameters["token_aware"] = LogicalType::BOOLEAN;      // Route requests to replicas
+}
+
 static unique_ptr<FunctionData> CassandraScanBind(ClientContext &context, TableFunctionBindInput &input,
                                                   vector<LogicalType> &return_types, vector<string> &names) {
     auto bind_data = make_uniq<CassandraScanBindData>();
@@ -48,8 +274,9 @@ static unique_ptr<FunctionData> CassandraScanBind(ClientContext &context, TableF
         throw BinderException("Table name must include keyspace: keyspace.table");
     }
     
-    // Set default configuration
+    // Set default configuration, then the SET cassandra_* options
     bind_data->config = CassandraConfig();
+    CassandraSettings::ApplyToConfig(context, bind_data->config);
     
     // Parse named parameters
     for (auto &kv : input.named_parameters) {
@@ -103,10 +330,24 @@ static unique_ptr<FunctionData> CassandraScanBind(ClientContext &context, TableF
             bind_data->config.usercert_b64 = StringValue::Get(kv.second);
         } else if (lower_key == "userkey_b64") {
             bind_data->config.userkey_b64 = StringValue::Get(kv.second);
+        } else if (lower_key == "zero_copy") {
+            bind_data->zero_copy = BooleanValue::Get(kv.second);
+        } else if (lower_key == "decimal_scale") {
+            bind_data->config.decimal_scale = IntegerValue::Get(kv.second);
+        } else if (lower_key == "statistics_sample_rows") {
+            bind_data->config.statistics_sample_rows = IntegerValue::Get(kv.second);
+        } else if (lower_key == "splits") {
+            auto splits = IntegerValue::Get(kv.second);
+            if (splits < 1) {
+                throw BinderException("cassandra_scan splits must be at least 1");
+            }
+            bind_data->split_count = NumericCast<idx_t>(splits);
+        } else {
+            ParseTuningParameter(lower_key, kv.second, bind_data->config);
         }
     }
     
-    // Get schema by doing a LIMIT 1 query and extracting metadata
+    // Columns and keys come from the driver's schema metadata, no request is sent for them
     // Create or reuse connection during bind phase
     try {
         shared_ptr<CassandraClient> client;
@@ -114,95 +355,21 @@ static unique_ptr<FunctionData> CassandraScanBind(ClientContext &context, TableF
             // Use existing connection (e.g., from ATTACH catalog)
             client = bind_data->reused_connection;
         } else {
-            // Create new connection for direct function calls
-            bind_data->reused_connection = make_shared_ptr<CassandraClient>(bind_data->config);
+            // Lease the pooled connection to this cluster for direct function calls
+            bind_data->reused_connection = CassandraClientPool::Get().Acquire(bind_data->config);
             client = bind_data->reused_connection;
         }
-        string schema_query = "SELECT * FROM " + bind_data->table_ref.keyspace_name + "." + bind_data->table_ref.table_name + " LIMIT 1";
         
-        auto session = client->GetSession();
-        CassStatement* statement = cass_statement_new(schema_query.c_str(), 0);
-        CassFuture* result_future = cass_session_execute(session, statement);
-        
-        if (cass_future_error_code(result_future) == CASS_OK) {
-            const CassResult* result = cass_future_get_result(result_future);
-            size_t column_count = cass_result_column_count(result);
-            
-            for (size_t i = 0; i < column_count; i++) {
-                const char* column_name;
-                size_t name_length;
-                cass_result_column_name(result, i, &column_name, &name_length);
-                CassValueType column_type = cass_result_column_type(result, i);
-                
-                string col_name(column_name, name_length);
-                names.push_back(col_name);
-                
-                // Map types properly - use CORRECT types for binding
-                LogicalType duckdb_type;
-                switch (column_type) {
-                    case CASS_VALUE_TYPE_UUID:
-                    case CASS_VALUE_TYPE_TIMEUUID:
-                        duckdb_type = LogicalType::UUID;
-                        break;
-                    case CASS_VALUE_TYPE_TIMESTAMP:
-                        duckdb_type = LogicalType::TIMESTAMP_TZ;
-                        break;
-                    case CASS_VALUE_TYPE_DOUBLE:
-                        duckdb_type = LogicalType::DOUBLE;
-                        break;
-                    case CASS_VALUE_TYPE_INT:
-                        duckdb_type = LogicalType::INTEGER;
-                        break;
-                    case CASS_VALUE_TYPE_BIGINT:
-                        duckdb_type = LogicalType::BIGINT;
-                        break;
-                    case CASS_VALUE_TYPE_BOOLEAN:
-                        duckdb_type = LogicalType::BOOLEAN;
-                        break;
-                    case CASS_VALUE_TYPE_FLOAT:
-                        duckdb_type = LogicalType::FLOAT;
-                        break;
-                    case CASS_VALUE_TYPE_SMALL_INT:
-                        duckdb_type = LogicalType::SMALLINT;
-                        break;
-                    case CASS_VALUE_TYPE_TINY_INT:
-                        duckdb_type = LogicalType::TINYINT;
-                        break;
-                    case CASS_VALUE_TYPE_DATE:
-                        duckdb_type = LogicalType::DATE;
-                        break;
-                    case CASS_VALUE_TYPE_TIME:
-                        duckdb_type = LogicalType::TIME;
-                        break;
-                    case CASS_VALUE_TYPE_INET:
-                        duckdb_type = LogicalType::VARCHAR;  // INET as string
-                        break;
-                    case CASS_VALUE_TYPE_DECIMAL:
-                    case CASS_VALUE_TYPE_VARINT:
-                        duckdb_type = LogicalType::VARCHAR;  // Large numbers as strings
-                        break;
-                    case CASS_VALUE_TYPE_BLOB:
-                        duckdb_type = LogicalType::BLOB;
-                        break;
-                    case CASS_VALUE_TYPE_LIST:
-                    case CASS_VALUE_TYPE_SET:
-                    case CASS_VALUE_TYPE_MAP:
-                        duckdb_type = LogicalType::VARCHAR;  // Collections as JSON strings
-                        break;
-                    default:
-                        duckdb_type = LogicalType::VARCHAR;
-                        break;
-                }
-                
-                return_types.push_back(duckdb_type);
+        CassandraTableSchema schema;
+        if (client->GetTableSchema(bind_data->table_ref.keyspace_name, bind_data->table_ref.table_name, schema)) {
+            bind_data->LoadKeyColumns(schema);
+            names = schema.column_names;
+            for (auto &column_type : schema.column_types) {
+                return_types.push_back(CassandraTypeMapper::ToDuckDBType(column_type, bind_data->config.decimal_scale));
             }
-            
-            cass_result_free(result);
+            bind_data->column_cass_types = std::move(schema.column_types);
         }
         
-        cass_future_free(result_future);
-        cass_statement_free(statement);
-        
     } catch (const std::exception& e) {
         throw BinderException("Failed to get schema for table '%s': %s", 
                             table_name.c_str(), e.what());
@@ -210,445 +377,209 @@ static unique_ptr<FunctionData> CassandraScanBind(ClientContext &context, TableF
     
     // Ensure we have at least one column
     if (names.empty()) {
-        throw BinderException("Table '%s' has no columns or does not exist", 
-                            table_name.c_str());
+        throw BinderException("Table '%s' does not exist", table_name.c_str());
     }
+    bind_data->column_names = names;
+    bind_data->column_types = return_types;
+    bind_data->BindDecoders();
     
     return std::move(bind_data);
 }
 
 static unique_ptr<GlobalTableFunctionState> CassandraScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
-    auto bind_data = input.bind_data->Cast<CassandraScanBindData>();
+    auto &bind_data = input.bind_data->Cast<CassandraScanBindData>();
     auto result = make_uniq<CassandraScanGlobalState>();
+    result->options = bind_data.config;
     
     // Reuse connection from bind phase
     if (bind_data.reused_connection) {
         result->client = bind_data.reused_connection;
     } else {
-        result->client = make_shared_ptr<CassandraClient>(bind_data.config);
+        result->client = CassandraClientPool::Get().Acquire(bind_data.config);
     }
     
-    // Execute the actual data query
-    string query = "SELECT * FROM " + bind_data.table_ref.keyspace_name + "." + bind_data.table_ref.table_name;
+    // Only select the columns DuckDB asked for
+    string select_list;
+    idx_t cql_column = 0;
+    for (auto column_id : input.column_ids) {
+        if (column_id >= bind_data.column_names.size()) {
+            // rowid and other virtual columns are not stored in Cassandra
+            result->projection.push_back(DConstants::INVALID_INDEX);
+            result->decoders.push_back(CassandraColumnDecoder());
+            continue;
+        }
+        select_list += (select_list.empty() ? "" : ", ") + QuoteCQLIdentifier(bind_data.column_names[column_id]);
+        result->projection.push_back(cql_column++);
+        result->decoders.push_back(bind_data.decoders[column_id]);
+    }
+    if (select_list.empty()) {
+        // Nothing but row counts needed, fetch the smallest thing that identifies a row
+        select_list = QuoteCQLIdentifier(bind_data.partition_key.empty() ? bind_data.column_names[0]
+                                                                          : bind_data.partition_key[0]);
+    }
+    result->query = "SELECT " + select_list + " FROM " + bind_data.table_ref.keyspace_name + "." + bind_data.table_ref.table_name;
     
-    auto session = result->client->GetSession();
-    CassStatement* statement = cass_statement_new(query.c_str(), 0);
-    CassFuture* query_future = cass_session_execute(session, statement);
+    // A pushed down filter restricts the whole partition key, which is read from its replicas directly
+    if (!bind_data.filter_condition.empty()) {
+        result->query += " WHERE " + bind_data.filter_condition;
+        result->params = bind_data.filter_params;
+    }
     
-    if (cass_future_error_code(query_future) == CASS_OK) {
-        result->result = cass_future_get_result(query_future);
-        result->result_iterator = cass_iterator_from_result(result->result);
-        result->finished = false;
-    } else {
-        result->finished = true;
+    // Split the token ring so every worker thread streams its own ranges. A pushed down LIMIT
+    // would apply to every split, so limited scans stay a single stream.
+    if (bind_data.filter_condition.empty() && bind_data.limit == 0 && !bind_data.partition_key.empty() &&
+        bind_data.split_count != 1) {
+        auto statistics = bind_data.GetStatistics(context);
+        vector<CassandraSizeEstimate> estimates;
+        CassandraTableSize size;
+        if (statistics) {
+            estimates = statistics->estimates;
+            size = statistics->size;
+        }
+        idx_t split_count = bind_data.split_count;
+        if (split_count == 0) {
+            auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+            split_count = CassandraTokenRanges::GetSplitCount(size, thread_count);
+        }
+        if (split_count > 1) {
+            string token = "token(";
+            for (idx_t i = 0; i < bind_data.partition_key.size(); i++) {
+                token += (i > 0 ? ", " : "") + QuoteCQLIdentifier(bind_data.partition_key[i]);
+            }
+            token += ")";
+            result->query += " WHERE " + token + " > ? AND " + token + " <= ?";
+            result->ranges = CassandraTokenRanges::Split(estimates, split_count);
+            result->use_token_ranges = true;
+        }
+    }
+    if (result->ranges.empty()) {
+        result->ranges.push_back({CASSANDRA_MIN_TOKEN, CASSANDRA_MAX_TOKEN});
     }
     
-    cass_future_free(query_future);
-    cass_statement_free(statement);
+    if (bind_data.per_partition_limit > 0) {
+        result->query += " PER PARTITION LIMIT " + to_string(bind_data.per_partition_limit);
+    }
+    if (bind_data.limit > 0) {
+        result->query += " LIMIT " + to_string(bind_data.limit);
+    }
     
     return std::move(result);
 }
 
+static unique_ptr<LocalTableFunctionState> CassandraScanInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                                  GlobalTableFunctionState *global_state) {
+    return make_uniq<CassandraScanLocalState>();
+}
+
 static void CassandraScanExecute(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
     auto &gstate = data.global_state->Cast<CassandraScanGlobalState>();
+    auto &lstate = data.local_state->Cast<CassandraScanLocalState>();
     
-    if (gstate.finished || !gstate.result_iterator) {
-        output.SetCardinality(0);
-        return;
-    }
-    
+    // Fill the chunk across page and split boundaries
+    const CassRow* rows[STANDARD_VECTOR_SIZE];
     idx_t row_count = 0;
-    const idx_t chunk_size = STANDARD_VECTOR_SIZE;
-    
-    while (row_count < chunk_size && cass_iterator_next(gstate.result_iterator)) {
-        const CassRow* row = cass_iterator_get_row(gstate.result_iterator);
-        size_t column_count = cass_result_column_count(gstate.result);
-        
-        for (size_t col_idx = 0; col_idx < column_count && col_idx < output.ColumnCount(); col_idx++) {
-            const CassValue* value = cass_row_get_column(row, col_idx);
-            auto &vector = output.data[col_idx];
-            
-            // Handle NULL values first  
-            bool is_null = cass_value_is_null(value);
-            if (is_null) {
-                FlatVector::Validity(vector).SetInvalid(row_count);  // Direct call like DuckDB internals
-                
-                // Store appropriate default values even for NULLs (required by DuckDB)
-                LogicalType expected_type = vector.GetType();
-                switch (expected_type.id()) {
-                    case LogicalTypeId::UUID: {
-                        auto data_ptr = FlatVector::GetData<hugeint_t>(vector);
-                        data_ptr[row_count] = hugeint_t(0);
-                        break;
-                    }
-                    case LogicalTypeId::TIMESTAMP_TZ: {
-                        auto data_ptr = FlatVector::GetData<timestamp_t>(vector);
-                        data_ptr[row_count] = timestamp_t(0);
-                        break;
-                    }
-                    case LogicalTypeId::DOUBLE: {
-                        auto data_ptr = FlatVector::GetData<double>(vector);
-                        data_ptr[row_count] = 0.0;
-                        break;
-                    }
-                    case LogicalTypeId::INTEGER: {
-                        auto data_ptr = FlatVector::GetData<int32_t>(vector);
-                        data_ptr[row_count] = 0;
-                        break;
-                    }
-                    case LogicalTypeId::BIGINT: {
-                        auto data_ptr = FlatVector::GetData<int64_t>(vector);
-                        data_ptr[row_count] = 0;
-                        break;
-                    }
-                    case LogicalTypeId::BOOLEAN: {
-                        auto data_ptr = FlatVector::GetData<bool>(vector);
-                        data_ptr[row_count] = false;
-                        break;
-                    }
-                    case LogicalTypeId::FLOAT: {
-                        auto data_ptr = FlatVector::GetData<float>(vector);
-                        data_ptr[row_count] = 0.0f;
-                        break;
-                    }
-                    case LogicalTypeId::SMALLINT: {
-                        auto data_ptr = FlatVector::GetData<int16_t>(vector);
-                        data_ptr[row_count] = 0;
-                        break;
-                    }
-                    case LogicalTypeId::TINYINT: {
-                        auto data_ptr = FlatVector::GetData<int8_t>(vector);
-                        data_ptr[row_count] = 0;
-                        break;
-                    }
-                    case LogicalTypeId::DATE: {
-                        auto data_ptr = FlatVector::GetData<date_t>(vector);
-                        data_ptr[row_count] = date_t(0);
-                        break;
-                    }
-                    case LogicalTypeId::TIME: {
-                        auto data_ptr = FlatVector::GetData<dtime_t>(vector);
-                        data_ptr[row_count] = dtime_t(0);
-                        break;
-                    }
-                    case LogicalTypeId::BLOB:
-                    case LogicalTypeId::VARCHAR:
-                    default: {
-                        auto data_ptr = FlatVector::GetData<string_t>(vector);
-                        data_ptr[row_count] = StringVector::AddString(vector, "", 0);
-                        break;
-                    }
-                }
-                continue;  // Skip regular data processing for NULL values
+    while (row_count < STANDARD_VECTOR_SIZE && !lstate.finished) {
+        if (!lstate.stream) {
+            lstate.stream = gstate.NextStream();
+            if (!lstate.stream) {
+                lstate.finished = true;
+                break;
             }
-            
-            // Only process non-NULL values
-            LogicalType expected_type = vector.GetType();
-            CassValueType value_type = cass_value_type(value);
-            
-            switch (expected_type.id()) {
-                    case LogicalTypeId::UUID: {
-                        auto data_ptr = FlatVector::GetData<hugeint_t>(vector);
-                        CassUuid uuid_val;
-                        cass_value_get_uuid(value, &uuid_val);
-                        char uuid_str[CASS_UUID_STRING_LENGTH];
-                        cass_uuid_string(uuid_val, uuid_str);
-                        hugeint_t uuid_hugeint;
-                        if (UUID::FromCString(uuid_str, strlen(uuid_str), uuid_hugeint)) {
-                            data_ptr[row_count] = uuid_hugeint;
-                        } else {
-                            FlatVector::Validity(vector).SetInvalid(row_count);
-                        }
-                        break;
-                    }
-                    case LogicalTypeId::TIMESTAMP_TZ: {
-                        auto data_ptr = FlatVector::GetData<timestamp_t>(vector);
-                        cass_int64_t timestamp_ms;
-                        cass_value_get_int64(value, &timestamp_ms);
-                        data_ptr[row_count] = timestamp_t(timestamp_ms * 1000);
-                        break;
-                    }
-                    case LogicalTypeId::DOUBLE: {
-                        auto data_ptr = FlatVector::GetData<double>(vector);
-                        cass_double_t double_val;
-                        cass_value_get_double(value, &double_val);
-                        data_ptr[row_count] = double_val;
-                        break;
-                    }
-                    case LogicalTypeId::INTEGER: {
-                        auto data_ptr = FlatVector::GetData<int32_t>(vector);
-                        cass_int32_t int_val;
-                        cass_value_get_int32(value, &int_val);
-                        data_ptr[row_count] = int_val;
-                        break;
-                    }
-                    case LogicalTypeId::BIGINT: {
-                        auto data_ptr = FlatVector::GetData<int64_t>(vector);
-                        cass_int64_t bigint_val;
-                        cass_value_get_int64(value, &bigint_val);
-                        data_ptr[row_count] = bigint_val;
-                        break;
-                    }
-                    case LogicalTypeId::BOOLEAN: {
-                        auto data_ptr = FlatVector::GetData<bool>(vector);
-                        cass_bool_t bool_val;
-                        cass_value_get_bool(value, &bool_val);
-                        data_ptr[row_count] = bool_val;
-                        break;
-                    }
-                    case LogicalTypeId::FLOAT: {
-                        auto data_ptr = FlatVector::GetData<float>(vector);
-                        cass_float_t float_val;
-                        cass_value_get_float(value, &float_val);
-                        data_ptr[row_count] = float_val;
-                        break;
-                    }
-                    case LogicalTypeId::SMALLINT: {
-                        auto data_ptr = FlatVector::GetData<int16_t>(vector);
-                        cass_int16_t smallint_val;
-                        cass_value_get_int16(value, &smallint_val);
-                        data_ptr[row_count] = smallint_val;
-                        break;
-                    }
-                    case LogicalTypeId::TINYINT: {
-                        auto data_ptr = FlatVector::GetData<int8_t>(vector);
-                        cass_int8_t tinyint_val;
-                        cass_value_get_int8(value, &tinyint_val);
-                        data_ptr[row_count] = tinyint_val;
-                        break;
-                    }
-                    case LogicalTypeId::DATE: {
-                        auto data_ptr = FlatVector::GetData<date_t>(vector);
-                        cass_uint32_t date_val;
-                        cass_value_get_uint32(value, &date_val);
-                        // Cassandra DATE is days since epoch (1970-01-01)
-                        data_ptr[row_count] = date_t(date_val);
-                        break;
-                    }
-                    case LogicalTypeId::TIME: {
-                        auto data_ptr = FlatVector::GetData<dtime_t>(vector);
-                        cass_int64_t time_val;
-                        cass_value_get_int64(value, &time_val);
-                        // Cassandra TIME is nanoseconds since midnight
-                        data_ptr[row_count] = dtime_t(time_val / 1000);  // Convert to microseconds
-                        break;
-                    }
-                    case LogicalTypeId::BLOB: {
-                        auto data_ptr = FlatVector::GetData<string_t>(vector);
-                        const cass_byte_t* bytes;
-                        size_t bytes_size;
-                        cass_value_get_bytes(value, &bytes, &bytes_size);
-                        data_ptr[row_count] = StringVector::AddString(vector, (const char*)bytes, bytes_size);
-                        break;
-                    }
-                    case LogicalTypeId::VARCHAR:
-                    default: {
-                        auto data_ptr = FlatVector::GetData<string_t>(vector);
-                        string string_val;
-                        
-                        switch (value_type) {
-                            case CASS_VALUE_TYPE_ASCII:
-                            case CASS_VALUE_TYPE_TEXT:
-                            case CASS_VALUE_TYPE_VARCHAR: {
-                                const char* str_val;
-                                size_t str_len;
-                                cass_value_get_string(value, &str_val, &str_len);
-                                string_val = string(str_val, str_len);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_UUID:
-                            case CASS_VALUE_TYPE_TIMEUUID: {
-                                CassUuid uuid_val;
-                                cass_value_get_uuid(value, &uuid_val);
-                                char uuid_str[CASS_UUID_STRING_LENGTH];
-                                cass_uuid_string(uuid_val, uuid_str);
-                                string_val = string(uuid_str);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_MAP: {
-                                string_val = "{";
-                                CassIterator* map_iterator = cass_iterator_from_map(value);
-                                bool first = true;
-                                while (cass_iterator_next(map_iterator)) {
-                                    if (!first) string_val += ", ";
-                                    first = false;
-                                    
-                                    const CassValue* key = cass_iterator_get_map_key(map_iterator);
-                                    const CassValue* val = cass_iterator_get_map_value(map_iterator);
-                                    
-                                    const char* key_str;
-                                    size_t key_len;
-                                    cass_value_get_string(key, &key_str, &key_len);
-                                    
-                                    const char* val_str;
-                                    size_t val_len;
-                                    cass_value_get_string(val, &val_str, &val_len);
-                                    
-                                    string_val += "'" + string(key_str, key_len) + "': '" + string(val_str, val_len) + "'";
-                                }
-                                string_val += "}";
-                                cass_iterator_free(map_iterator);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_BOOLEAN: {
-                                cass_bool_t bool_val;
-                                cass_value_get_bool(value, &bool_val);
-                                string_val = bool_val ? "true" : "false";
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_LIST: {
-                                string_val = "[";
-                                CassIterator* list_iterator = cass_iterator_from_collection(value);
-                                bool first = true;
-                                while (cass_iterator_next(list_iterator)) {
-                                    if (!first) string_val += ", ";
-                                    first = false;
-                                    
-                                    const CassValue* item = cass_iterator_get_value(list_iterator);
-                                    const char* item_str;
-                                    size_t item_len;
-                                    cass_value_get_string(item, &item_str, &item_len);
-                                    string_val += "'" + string(item_str, item_len) + "'";
-                                }
-                                string_val += "]";
-                                cass_iterator_free(list_iterator);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_INT: {
-                                cass_int32_t int_val;
-                                cass_value_get_int32(value, &int_val);
-                                string_val = std::to_string(int_val);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_DOUBLE: {
-                                cass_double_t double_val;
-                                cass_value_get_double(value, &double_val);
-                                string_val = std::to_string(double_val);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_BIGINT: {
-                                cass_int64_t bigint_val;
-                                cass_value_get_int64(value, &bigint_val);
-                                string_val = std::to_string(bigint_val);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_FLOAT: {
-                                cass_float_t float_val;
-                                cass_value_get_float(value, &float_val);
-                                string_val = std::to_string(float_val);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_TINY_INT: {
-                                cass_int8_t tiny_val;
-                                cass_value_get_int8(value, &tiny_val);
-                                string_val = std::to_string(tiny_val);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_SMALL_INT: {
-                                cass_int16_t small_val;
-                                cass_value_get_int16(value, &small_val);
-                                string_val = std::to_string(small_val);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_BLOB: {
-                                const cass_byte_t* blob_data;
-                                size_t blob_size;
-                                cass_value_get_bytes(value, &blob_data, &blob_size);
-                                string_val = "blob(";
-                                for (size_t i = 0; i < std::min(blob_size, (size_t)8); i++) {
-                                    if (i > 0) string_val += " ";
-                                    char hex[3];
-                                    snprintf(hex, sizeof(hex), "%02x", blob_data[i]);
-                                    string_val += hex;
-                                }
-                                if (blob_size > 8) string_val += "...";
-                                string_val += ")";
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_VARINT: {
-                                const cass_byte_t* varint_data;
-                                size_t varint_size;
-                                cass_value_get_bytes(value, &varint_data, &varint_size);
-                                string_val = "varint(";
-                                for (size_t i = 0; i < std::min(varint_size, (size_t)8); i++) {
-                                    if (i > 0) string_val += " ";
-                                    char hex[3];
-                                    snprintf(hex, sizeof(hex), "%02x", varint_data[i]);
-                                    string_val += hex;
-                                }
-                                if (varint_size > 8) string_val += "...";
-                                string_val += ")";
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_DECIMAL: {
-                                const cass_byte_t* decimal_data;
-                                size_t decimal_size;
-                                cass_int32_t scale;
-                                cass_value_get_decimal(value, &decimal_data, &decimal_size, &scale);
-                                string_val = "decimal(scale=" + std::to_string(scale) + ")";
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_DATE: {
-                                cass_uint32_t date_val;
-                                cass_value_get_uint32(value, &date_val);
-                                string_val = "date(" + std::to_string(date_val) + ")";
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_TIME: {
-                                cass_int64_t time_val;
-                                cass_value_get_int64(value, &time_val);
-                                string_val = "time(" + std::to_string(time_val) + ")";
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_INET: {
-                                CassInet inet_val;
-                                cass_value_get_inet(value, &inet_val);
-                                char inet_str[CASS_INET_STRING_LENGTH];
-                                cass_inet_string(inet_val, inet_str);
-                                string_val = string(inet_str);
-                                break;
-                            }
-                            case CASS_VALUE_TYPE_TIMESTAMP: {
-                                cass_int64_t timestamp_ms;
-                                cass_value_get_int64(value, &timestamp_ms);
-                                time_t time_sec = timestamp_ms / 1000;
-                                int ms_part = timestamp_ms % 1000;
-                                struct tm* utc_tm = gmtime(&time_sec);
-                                char timestamp_str[64];
-                                snprintf(timestamp_str, sizeof(timestamp_str), "%04d-%02d-%02d %02d:%02d:%02d.%03d000+0000",
-                                       utc_tm->tm_year + 1900, utc_tm->tm_mon + 1, utc_tm->tm_mday,
-                                       utc_tm->tm_hour, utc_tm->tm_min, utc_tm->tm_sec, ms_part);
-                                string_val = string(timestamp_str);
-                                break;
-                            }
-                            default:
-                                if (cass_value_is_null(value)) {
-                                    string_val = "";
-                                } else {
-                                    string_val = "<unknown_type:" + std::to_string(static_cast<int>(value_type)) + ">";
-                                }
-                                break;
-                        }
-                        
-                        data_ptr[row_count] = StringVector::AddString(vector, string_val);
-                        break;
-                    }
+        }
+        idx_t fetched = lstate.stream->Fetch(rows, STANDARD_VECTOR_SIZE - row_count);
+        if (fetched == 0) {
+            lstate.stream.reset();
+            continue;
+        }
+        // Decode the segment column by column
+        buffer_ptr<VectorBuffer> page_buffer;
+        for (idx_t col_idx = 0; col_idx < gstate.projection.size(); col_idx++) {
+            if (gstate.projection[col_idx] == DConstants::INVALID_INDEX) {
+                continue;
+            }
+            auto &decoder = gstate.decoders[col_idx];
+            decoder.decode(decoder, rows, fetched, gstate.projection[col_idx], output.data[col_idx], row_count);
+            if (decoder.references_page) {
+                // Keep the page alive for as long as the strings pointing into it
+                if (!page_buffer) {
+                    page_buffer = make_buffer<CassandraPageBuffer>(lstate.stream->CurrentPage());
+                }
+                StringVector::AddBuffer(output.data[col_idx], page_buffer);
             }
         }
-        
-        row_count++;
+        row_count += fetched;
     }
     
-    if (row_count == 0) {
-        gstate.finished = true;
+    // Virtual columns such as rowid have no value in Cassandra
+    for (idx_t col_idx = 0; col_idx < gstate.projection.size(); col_idx++) {
+        if (gstate.projection[col_idx] == DConstants::INVALID_INDEX) {
+            output.data[col_idx].SetVectorType(VectorType::CONSTANT_VECTOR);
+            ConstantVector::SetNull(output.data[col_idx], true);
+        }
     }
-    
     output.SetCardinality(row_count);
 }
 
+shared_ptr<const CassandraTableStatistics> CassandraScanBindData::GetStatistics(ClientContext &context) const {
+    if (!query.empty() || partition_key.empty() || !reused_connection) {
+        return nullptr;
+    }
+    return reused_connection->GetTableStatistics(context, table_ref, partition_key, clustering_key, config);
+}
+
+static unique_ptr<NodeStatistics> CassandraScanCardinality(ClientContext &context, const FunctionData *bind_data_p) {
+    auto &bind_data = bind_data_p->Cast<CassandraScanBindData>();
+    auto statistics = bind_data.GetStatistics(context);
+    if (!statistics || statistics->rows == 0) {
+        return nullptr;
+    }
+    idx_t rows = statistics->rows;
+    if (!bind_data.filter_condition.empty()) {
+        // The pushed down filter fixes the partition key, expect a single partition
+        rows = MaxValue<idx_t>(rows / MaxValue<idx_t>(static_cast<idx_t>(statistics->size.partitions), 1), 1);
+    }
+    if (bind_data.limit > 0) {
+        rows = MinValue<idx_t>(rows, bind_data.limit);
+    }
+    return make_uniq<NodeStatistics>(rows);
+}
+
+static unique_ptr<BaseStatistics> CassandraScanStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                                          column_t column_index) {
+    auto &bind_data = bind_data_p->Cast<CassandraScanBindData>();
+    if (column_index >= bind_data.column_names.size()) {
+        return nullptr;
+    }
+    auto statistics = bind_data.GetStatistics(context);
+    if (!statistics) {
+        return nullptr;
+    }
+    return statistics->GetColumnStatistics(bind_data.column_names[column_index], bind_data.column_types[column_index]);
+}
+
+// Shown by EXPLAIN: the table and what was pushed down into the CQL query
+static InsertionOrderPreservingMap<string> CassandraScanToString(TableFunctionToStringInput &input) {
+    InsertionOrderPreservingMap<string> result;
+    if (!input.bind_data) {
+        return result;
+    }
+    auto &bind_data = input.bind_data->Cast<CassandraScanBindData>();
+    result["Table"] = bind_data.table_ref.GetQualifiedName();
+    if (!bind_data.filter_condition.empty()) {
+        result["CQL Filter"] = bind_data.filter_condition;
+    }
+    if (bind_data.per_partition_limit > 0) {
+        result["CQL Per Partition Limit"] = to_string(bind_data.per_partition_limit);
+    }
+    if (bind_data.limit > 0) {
+        result["CQL Limit"] = to_string(bind_data.limit);
+    }
+    return result;
+}
+
 CassandraScanFunction::CassandraScanFunction() 
     : TableFunction("cassandra_scan", {LogicalType::VARCHAR}, CassandraScanExecute, CassandraScanBind, 
-                    CassandraScanInitGlobal, nullptr) {
+                    CassandraScanInitGlobal, CassandraScanInitLocal) {
     
     named_parameters["contact_points"] = LogicalType::VARCHAR;
     named_parameters["host"] = LogicalType::VARCHAR;
@@ -674,6 +605,17 @@ CassandraScanFunction::CassandraScanFunction()
     named_parameters["certfile_b64"] = LogicalType::VARCHAR; // Base64 encoded SSL CA cert
     named_parameters["usercert_b64"] = LogicalType::VARCHAR; // Base64 encoded SSL user cert
     named_parameters["userkey_b64"] = LogicalType::VARCHAR;  // Base64 encoded SSL private key
+    named_parameters["splits"] = LogicalType::INTEGER;       // Number of token ranges to scan in parallel
+    named_parameters["zero_copy"] = LogicalType::BOOLEAN;    // Reference text/blob values in the result pages
+    named_parameters["decimal_scale"] = LogicalType::INTEGER; // Read decimal columns as DECIMAL(38, scale)
+    named_parameters["statistics_sample_rows"] = LogicalType::INTEGER; // Rows sampled for key column statistics
+    AddTuningParameters(named_parameters);
+    
+    projection_pushdown = true;
+    pushdown_complex_filter = CassandraFilterPushdown::PushdownComplexFilter;
+    cardinality = CassandraScanCardinality;
+    statistics = CassandraScanStatistics;
+    to_string = CassandraScanToString;
 }
 
 // Custom query function implementation
@@ -686,10 +628,11 @@ static unique_ptr<FunctionData> CassandraQueryBind(ClientContext &context, Table
     }
     
     auto query = StringValue::Get(input.inputs[0]);
-    bind_data->filter_condition = query; // Store the custom query
+    bind_data->query = query; // Store the custom query
     
-    // Set default configuration
+    // Set default configuration, then the SET cassandra_* options
     bind_data->config = CassandraConfig();
+    CassandraSettings::ApplyToConfig(context, bind_data->config);
     
     // Parse named parameters for connection
     for (auto &kv : input.named_parameters) {
@@ -740,6 +683,12 @@ static unique_ptr<FunctionData> CassandraQueryBind(ClientContext &context, Table
             bind_data->config.usercert_b64 = StringValue::Get(kv.second);
         } else if (lower_key == "userkey_b64") {
             bind_data->config.userkey_b64 = StringValue::Get(kv.second);
+        } else if (lower_key == "zero_copy") {
+            bind_data->zero_copy = BooleanValue::Get(kv.second);
+        } else if (lower_key == "decimal_scale") {
+            bind_data->config.decimal_scale = IntegerValue::Get(kv.second);
+        } else {
+            ParseTuningParameter(lower_key, kv.second, bind_data->config);
         }
     }
     
@@ -751,90 +700,45 @@ static unique_ptr<FunctionData> CassandraQueryBind(ClientContext &context, Table
             // Use existing connection (e.g., from ATTACH catalog)
             client = bind_data->reused_connection;
         } else {
-            // Create new connection for direct function calls
-            bind_data->reused_connection = make_shared_ptr<CassandraClient>(bind_data->config);
+            // Lease the pooled connection to this cluster for direct function calls
+            bind_data->reused_connection = CassandraClientPool::Get().Acquire(bind_data->config);
             client = bind_data->reused_connection;
         }
+        // The driver exposes no result metadata on prepared statements, so the columns are read
+        // from the first page. That page is kept and handed to the scan, which pages on from
+        // there, so the statement runs once.
         auto session = client->GetSession();
-        CassStatement* statement = cass_statement_new(query.c_str(), 0);
-        CassFuture* result_future = cass_session_execute(session, statement);
+        CassStatement* statement = client->NewStatement(query);
+        CassandraClient::ConfigureStatement(statement, bind_data->config);
+        CassFuture* result_future = cass_session_execute(session.get(), statement);
         
-        if (cass_future_error_code(result_future) == CASS_OK) {
-            const CassResult* result = cass_future_get_result(result_future);
-            size_t column_count = cass_result_column_count(result);
-            
-            for (size_t i = 0; i < column_count; i++) {
-                const char* column_name;
-                size_t name_length;
-                cass_result_column_name(result, i, &column_name, &name_length);
-                CassValueType column_type = cass_result_column_type(result, i);
-                
-                string col_name(column_name, name_length);
-                names.push_back(col_name);
-                
-                // Map types properly - use CORRECT types for binding
-                LogicalType duckdb_type;
-                switch (column_type) {
-                    case CASS_VALUE_TYPE_UUID:
-                    case CASS_VALUE_TYPE_TIMEUUID:
-                        duckdb_type = LogicalType::UUID;
-                        break;
-                    case CASS_VALUE_TYPE_TIMESTAMP:
-                        duckdb_type = LogicalType::TIMESTAMP_TZ;
-                        break;
-                    case CASS_VALUE_TYPE_DOUBLE:
-                        duckdb_type = LogicalType::DOUBLE;
-                        break;
-                    case CASS_VALUE_TYPE_INT:
-                        duckdb_type = LogicalType::INTEGER;
-                        break;
-                    case CASS_VALUE_TYPE_BIGINT:
-                        duckdb_type = LogicalType::BIGINT;
-                        break;
-                    case CASS_VALUE_TYPE_BOOLEAN:
-                        duckdb_type = LogicalType::BOOLEAN;
-                        break;
-                    case CASS_VALUE_TYPE_FLOAT:
-                        duckdb_type = LogicalType::FLOAT;
-                        break;
-                    case CASS_VALUE_TYPE_SMALL_INT:
-                        duckdb_type = LogicalType::SMALLINT;
-                        break;
-                    case CASS_VALUE_TYPE_TINY_INT:
-                        duckdb_type = LogicalType::TINYINT;
-                        break;
-                    case CASS_VALUE_TYPE_DATE:
-                        duckdb_type = LogicalType::DATE;
-                        break;
-                    case CASS_VALUE_TYPE_TIME:
-                        duckdb_type = LogicalType::TIME;
-                        break;
-                    case CASS_VALUE_TYPE_INET:
-                        duckdb_type = LogicalType::VARCHAR;  // INET as string
-                        break;
-                    case CASS_VALUE_TYPE_DECIMAL:
-                    case CASS_VALUE_TYPE_VARINT:
-                        duckdb_type = LogicalType::VARCHAR;  // Large numbers as strings
-                        break;
-                    case CASS_VALUE_TYPE_BLOB:
-                        duckdb_type = LogicalType::BLOB;
-                        break;
-                    case CASS_VALUE_TYPE_LIST:
-                    case CASS_VALUE_TYPE_SET:
-                    case CASS_VALUE_TYPE_MAP:
-                        duckdb_type = LogicalType::VARCHAR;  // Collections as JSON strings
-                        break;
-                    default:
-                        duckdb_type = LogicalType::VARCHAR;
-                        break;
-                }
-                
-                return_types.push_back(duckdb_type);
-            }
+        auto error_code = cass_future_error_code(result_future);
+        if (error_code != CASS_OK) {
+            auto message = CassandraClient::GetErrorMessage(result_future);
+            cass_future_free(result_future);
+            cass_statement_free(statement);
+            client->ReportError(error_code);
+            throw IOException(message);
+        }
+
+        const CassResult* result = cass_future_get_result(result_future);
+        size_t column_count = cass_result_column_count(result);
+        
+        for (size_t i = 0; i < column_count; i++) {
+            const char* column_name;
+            size_t name_length;
+            cass_result_column_name(result, i, &column_name, &name_length);
+            // Full type including collection element types and UDT fields
+            auto column_type = CassandraType::FromDataType(cass_result_column_data_type(result, i));
             
-            cass_result_free(result);
+            string col_name(column_name, name_length);
+            names.push_back(col_name);
+            return_types.push_back(CassandraTypeMapper::ToDuckDBType(column_type, bind_data->config.decimal_scale));
+            bind_data->column_cass_types.push_back(std::move(column_type));
         }
         
+        bind_data->first_page = shared_ptr<const CassResult>(result, cass_result_free);
+        
         cass_future_free(result_future);
         cass_statement_free(statement);
         
@@ -848,45 +752,41 @@ static unique_ptr<FunctionData> CassandraQueryBind(ClientContext &context, Table
         throw BinderException("CQL query '%s' failed", 
                             query.c_str());
     }
+    bind_data->column_names = names;
+    bind_data->column_types = return_types;
+    bind_data->BindDecoders();
     
     return std::move(bind_data);
 }
 
 static unique_ptr<GlobalTableFunctionState> CassandraQueryInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
-    auto bind_data = input.bind_data->Cast<CassandraScanBindData>();
+    auto &bind_data = input.bind_data->Cast<CassandraScanBindData>();
     auto result = make_uniq<CassandraScanGlobalState>();
+    result->options = bind_data.config;
     
     // Reuse connection from bind phase
     if (bind_data.reused_connection) {
         result->client = bind_data.reused_connection;
     } else {
-        result->client = make_shared_ptr<CassandraClient>(bind_data.config);
+        result->client = CassandraClientPool::Get().Acquire(bind_data.config);
     }
     
-    // Execute the custom CQL query
-    string query = bind_data.filter_condition;
-    
-    auto session = result->client->GetSession();
-    CassStatement* statement = cass_statement_new(query.c_str(), 0);
-    CassFuture* query_future = cass_session_execute(session, statement);
-    
-    if (cass_future_error_code(query_future) == CASS_OK) {
-        result->result = cass_future_get_result(query_future);
-        result->result_iterator = cass_iterator_from_result(result->result);
-        result->finished = false;
-    } else {
-        result->finished = true;
+    // The custom CQL query is streamed as a single split, starting from the page bind fetched
+    result->query = bind_data.query;
+    result->first_page = bind_data.TakeFirstPage();
+    for (auto column_id : input.column_ids) {
+        bool is_stored = column_id < bind_data.column_names.size();
+        result->projection.push_back(is_stored ? column_id : DConstants::INVALID_INDEX);
+        result->decoders.push_back(is_stored ? bind_data.decoders[column_id] : CassandraColumnDecoder());
     }
-    
-    cass_future_free(query_future);
-    cass_statement_free(statement);
+    result->ranges.push_back({CASSANDRA_MIN_TOKEN, CASSANDRA_MAX_TOKEN});
     
     return std::move(result);
 }
 
 CassandraQueryFunction::CassandraQueryFunction()
     : TableFunction("cassandra_query", {LogicalType::VARCHAR}, CassandraScanExecute, CassandraQueryBind,
-                    CassandraQueryInitGlobal, nullptr) {
+                    CassandraQueryInitGlobal, CassandraScanInitLocal) {
     
     named_parameters["contact_points"] = LogicalType::VARCHAR;
     named_parameters["host"] = LogicalType::VARCHAR;
@@ -912,6 +812,9 @@ CassandraQueryFunction::CassandraQueryFunction()
     named_parameters["certfile_b64"] = LogicalType::VARCHAR; // Base64 encoded SSL CA cert
     named_parameters["usercert_b64"] = LogicalType::VARCHAR; // Base64 encoded SSL user cert
     named_parameters["userkey_b64"] = LogicalType::VARCHAR;  // Base64 encoded SSL private key
+    named_parameters["zero_copy"] = LogicalType::BOOLEAN;    // Reference text/blob values in the result pages
+    named_parameters["decimal_scale"] = LogicalType::INTEGER; // Read decimal columns as DECIMAL(38, scale)
+    AddTuningParameters(named_parameters);
 }
 
 } // namespace cassandra
@@ -95,5 +95,60 @@ std::string CassandraSettings::GetUserCertHex(ClientContext &context) {
     return "";
 }
 
+void CassandraSettings::ApplyToConfig(ClientContext &context, CassandraConfig &config) {
+    Value value;
+    if (context.TryGetCurrentSetting("cassandra_consistency", value) && !value.IsNull()) {
+        config.consistency = StringValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_serial_consistency", value) && !value.IsNull()) {
+        config.serial_consistency = StringValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_io_threads", value) && !value.IsNull()) {
+        config.io_threads = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_core_connections", value) && !value.IsNull()) {
+        config.core_connections_per_host = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_queue_size", value) && !value.IsNull()) {
+        config.queue_size_io = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_request_timeout", value) && !value.IsNull()) {
+        config.request_timeout_ms = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_connect_timeout", value) && !value.IsNull()) {
+        config.connect_timeout_ms = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_tcp_nodelay", value) && !value.IsNull()) {
+        config.tcp_nodelay = BooleanValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_tcp_keepalive", value) && !value.IsNull()) {
+        config.tcp_keepalive_secs = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_coalesce_delay", value) && !value.IsNull()) {
+        config.coalesce_delay_us = BigIntValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_page_size", value) && !value.IsNull()) {
+        config.page_size = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_local_dc", value) && !value.IsNull()) {
+        config.local_dc = StringValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_token_aware", value) && !value.IsNull()) {
+        config.token_aware = BooleanValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_write_concurrency", value) && !value.IsNull()) {
+        config.write_concurrency = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_write_batch_size", value) && !value.IsNull()) {
+        config.write_batch_size = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_write_retries", value) && !value.IsNull()) {
+        config.write_retries = IntegerValue::Get(value);
+    }
+    if (context.TryGetCurrentSetting("cassandra_write_rate", value) && !value.IsNull()) {
+        config.write_rate = BigIntValue::Get(value);
+    }
+}
+
 } // namespace cassandra
-} // namespace duckdb
\ No newline at end of file
+} // namespace duckdb
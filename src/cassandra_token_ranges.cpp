@@ -0,0 +1,320 @@
+#include "cassandra_token_ranges.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace duckdb {
+namespace cassandra {
+
+// Amount of data each split should cover
+static constexpr double CASSANDRA_TARGET_SPLIT_BYTES = 64.0 * 1024 * 1024;
+static constexpr idx_t CASSANDRA_MAX_SPLITS = 4096;
+// Candidate keys hashed per routing key search; narrower ranges than ~2^48 tokens are not routed
+static constexpr idx_t CASSANDRA_ROUTING_KEY_ATTEMPTS = 1 << 16;
+
+namespace {
+
+struct RingSegment {
+    int64_t start;
+    int64_t end;
+    double bytes;
+};
+
+uint64_t Rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+uint64_t Fmix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+uint64_t LoadLittleEndian64(const uint8_t* data) {
+    uint64_t result = 0;
+    for (idx_t i = 0; i < 8; i++) {
+        result |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return result;
+}
+
+// Tail bytes are sign extended, as Cassandra's MurmurHash reads them as Java bytes
+uint64_t TailByte(const uint8_t* data, idx_t index, int shift) {
+    return static_cast<uint64_t>(static_cast<int64_t>(static_cast<int8_t>(data[index]))) << shift;
+}
+
+double TokenWidth(int64_t start, int64_t end) {
+    return static_cast<double>(end) - static_cast<double>(start);
+}
+
+// Size estimates may wrap around the ring (start >= end); unwrap them into (start, end] pieces
+void AddEstimate(vector<RingSegment> &segments, const CassandraSizeEstimate &estimate) {
+    double bytes = static_cast<double>(estimate.partitions_count) * static_cast<double>(estimate.mean_partition_size);
+    if (estimate.range_start < estimate.range_end) {
+        segments.push_back({estimate.range_start, estimate.range_end, bytes});
+        return;
+    }
+    double upper_width = TokenWidth(estimate.range_start, CASSANDRA_MAX_TOKEN);
+    double lower_width = TokenWidth(CASSANDRA_MIN_TOKEN, estimate.range_end);
+    double total_width = upper_width + lower_width;
+    if (total_width <= 0) {
+        return;
+    }
+    if (upper_width > 0) {
+        segments.push_back({estimate.range_start, CASSANDRA_MAX_TOKEN, bytes * upper_width / total_width});
+    }
+    if (lower_width > 0) {
+        segments.push_back({CASSANDRA_MIN_TOKEN, estimate.range_end, bytes * lower_width / total_width});
+    }
+}
+
+// Build segments covering the whole ring. Gaps not reported by the node get the average density.
+vector<RingSegment> BuildRing(const vector<CassandraSizeEstimate> &estimates) {
+    vector<RingSegment> known;
+    for (auto &estimate : estimates) {
+        AddEstimate(known, estimate);
+    }
+    std::sort(known.begin(), known.end(),
+              [](const RingSegment &a, const RingSegment &b) { return a.start < b.start; });
+
+    double known_bytes = 0;
+    double known_width = 0;
+    for (auto &segment : known) {
+        known_bytes += segment.bytes;
+        known_width += TokenWidth(segment.start, segment.end);
+    }
+    if (known_bytes <= 0 || known_width <= 0) {
+        // Nothing usable, assume data is spread evenly over the ring
+        return {{CASSANDRA_MIN_TOKEN, CASSANDRA_MAX_TOKEN, TokenWidth(CASSANDRA_MIN_TOKEN, CASSANDRA_MAX_TOKEN)}};
+    }
+    double density = known_bytes / known_width;
+
+    vector<RingSegment> ring;
+    int64_t position = CASSANDRA_MIN_TOKEN;
+    for (auto &segment : known) {
+        if (segment.end <= position) {
+            continue;
+        }
+        int64_t start = std::max(segment.start, position);
+        if (start > position) {
+            ring.push_back({position, start, density * TokenWidth(position, start)});
+        }
+        double fraction = TokenWidth(start, segment.end) / TokenWidth(segment.start, segment.end);
+        ring.push_back({start, segment.end, segment.bytes * fraction});
+        position = segment.end;
+    }
+    if (position < CASSANDRA_MAX_TOKEN) {
+        ring.push_back({position, CASSANDRA_MAX_TOKEN, density * TokenWidth(position, CASSANDRA_MAX_TOKEN)});
+    }
+    return ring;
+}
+
+} // namespace
+
+CassandraTableSize CassandraTokenRanges::EstimateTableSize(const vector<CassandraSizeEstimate> &estimates) {
+    CassandraTableSize result;
+    vector<RingSegment> known;
+    for (auto &estimate : estimates) {
+        AddEstimate(known, estimate);
+    }
+    double covered_width = 0;
+    for (auto &segment : known) {
+        covered_width += TokenWidth(segment.start, segment.end);
+    }
+    if (covered_width <= 0) {
+        return result;
+    }
+    double partitions = 0;
+    double bytes = 0;
+    for (auto &estimate : estimates) {
+        partitions += static_cast<double>(estimate.partitions_count);
+        bytes += static_cast<double>(estimate.partitions_count) * static_cast<double>(estimate.mean_partition_size);
+    }
+    // A node only reports the ranges it owns, scale up to the full ring
+    double scale = TokenWidth(CASSANDRA_MIN_TOKEN, CASSANDRA_MAX_TOKEN) / covered_width;
+    result.partitions = partitions * scale;
+    result.bytes = bytes * scale;
+    result.has_estimates = true;
+    return result;
+}
+
+idx_t CassandraTokenRanges::GetSplitCount(const CassandraTableSize &size, idx_t thread_count) {
+    thread_count = MaxValue<idx_t>(thread_count, 1);
+    if (!size.has_estimates) {
+        return thread_count;
+    }
+    if (size.bytes < CASSANDRA_TARGET_SPLIT_BYTES) {
+        return 1;
+    }
+    auto by_size = static_cast<idx_t>(std::ceil(size.bytes / CASSANDRA_TARGET_SPLIT_BYTES));
+    return MinValue<idx_t>(MaxValue<idx_t>(by_size, thread_count), CASSANDRA_MAX_SPLITS);
+}
+
+vector<CassandraTokenRange> CassandraTokenRanges::Split(const vector<CassandraSizeEstimate> &estimates,
+                                                        idx_t split_count) {
+    vector<CassandraTokenRange> result;
+    if (split_count <= 1) {
+        result.push_back({CASSANDRA_MIN_TOKEN, CASSANDRA_MAX_TOKEN});
+        return result;
+    }
+
+    auto ring = BuildRing(estimates);
+    double total_bytes = 0;
+    for (auto &segment : ring) {
+        total_bytes += segment.bytes;
+    }
+    double target = total_bytes / static_cast<double>(split_count);
+
+    // Walk the ring and cut whenever another target's worth of data has been covered
+    vector<int64_t> cuts;
+    double covered = 0;
+    for (auto &segment : ring) {
+        while (cuts.size() + 1 < split_count && covered + segment.bytes >= target * static_cast<double>(cuts.size() + 1)) {
+            double needed = target * static_cast<double>(cuts.size() + 1) - covered;
+            double fraction = segment.bytes > 0 ? needed / segment.bytes : 1.0;
+            double position = static_cast<double>(segment.start) + fraction * TokenWidth(segment.start, segment.end);
+            int64_t cut = segment.end;
+            if (position < static_cast<double>(segment.end)) {
+                cut = static_cast<int64_t>(position);
+            }
+            cuts.push_back(cut);
+        }
+        covered += segment.bytes;
+    }
+
+    int64_t previous = CASSANDRA_MIN_TOKEN;
+    for (auto cut : cuts) {
+        if (cut <= previous || cut >= CASSANDRA_MAX_TOKEN) {
+            continue;
+        }
+        result.push_back({previous, cut});
+        previous = cut;
+    }
+    result.push_back({previous, CASSANDRA_MAX_TOKEN});
+    return result;
+}
+
+int64_t CassandraTokenRanges::GetToken(const uint8_t* data, idx_t size) {
+    // MurmurHash3 x64_128 with seed 0; the token is the first half of the hash
+    const uint64_t c1 = 0x87c37b91114253d5ULL;
+    const uint64_t c2 = 0x4cf5ad432745937fULL;
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+    idx_t blocks = size / 16;
+    for (idx_t i = 0; i < blocks; i++) {
+        uint64_t k1 = LoadLittleEndian64(data + i * 16);
+        uint64_t k2 = LoadLittleEndian64(data + i * 16 + 8);
+        k1 *= c1;
+        k1 = Rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+        h1 = Rotl64(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+        k2 *= c2;
+        k2 = Rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        h2 = Rotl64(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    auto tail = data + blocks * 16;
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+    switch (size & 15) {
+    case 15:
+        k2 ^= TailByte(tail, 14, 48);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 14:
+        k2 ^= TailByte(tail, 13, 40);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 13:
+        k2 ^= TailByte(tail, 12, 32);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 12:
+        k2 ^= TailByte(tail, 11, 24);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 11:
+        k2 ^= TailByte(tail, 10, 16);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 10:
+        k2 ^= TailByte(tail, 9, 8);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 9:
+        k2 ^= TailByte(tail, 8, 0);
+        k2 *= c2;
+        k2 = Rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 8:
+        k1 ^= TailByte(tail, 7, 56);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 7:
+        k1 ^= TailByte(tail, 6, 48);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 6:
+        k1 ^= TailByte(tail, 5, 40);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 5:
+        k1 ^= TailByte(tail, 4, 32);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 4:
+        k1 ^= TailByte(tail, 3, 24);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 3:
+        k1 ^= TailByte(tail, 2, 16);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 2:
+        k1 ^= TailByte(tail, 1, 8);
+        DUCKDB_EXPLICIT_FALLTHROUGH;
+    case 1:
+        k1 ^= TailByte(tail, 0, 0);
+        k1 *= c1;
+        k1 = Rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+        break;
+    default:
+        break;
+    }
+
+    h1 ^= size;
+    h2 ^= size;
+    h1 += h2;
+    h2 += h1;
+    h1 = Fmix64(h1);
+    h2 = Fmix64(h2);
+    h1 += h2;
+    auto token = static_cast<int64_t>(h1);
+    // The minimum token is reserved, Cassandra maps it to the maximum
+    return token == CASSANDRA_MIN_TOKEN ? CASSANDRA_MAX_TOKEN : token;
+}
+
+string CassandraTokenRanges::GetRoutingKey(const CassandraTokenRange &range) {
+    // The driver only hashes the routing key, so any bytes landing in the range will do.
+    // Whole 16 byte blocks keep the hash free of tail handling.
+    uint8_t key[16];
+    auto end = static_cast<uint64_t>(range.end);
+    for (idx_t i = 0; i < 8; i++) {
+        key[8 + i] = static_cast<uint8_t>(end >> (8 * i));
+    }
+    for (uint64_t attempt = 0; attempt < CASSANDRA_ROUTING_KEY_ATTEMPTS; attempt++) {
+        for (idx_t i = 0; i < 8; i++) {
+            key[i] = static_cast<uint8_t>(attempt >> (8 * i));
+        }
+        auto token = GetToken(key, sizeof(key));
+        if (token > range.start && token <= range.end) {
+            return string(reinterpret_cast<const char*>(key), sizeof(key));
+        }
+    }
+    return string();
+}
+
+} // namespace cassandra
+} // namespace duckdb
@@ -1,5 +1,9 @@
 #include "cassandra_types.hpp"
+#include "cassandra_decoder.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/decimal.hpp"
+#include "duckdb/common/types/hugeint.hpp"
 #include <iostream>
 
 namespace duckdb {
@@ -23,215 +27,341 @@ const std::unordered_map<CassValueType, LogicalType> CassandraTypeMapper::type_m
     {CASS_VALUE_TYPE_VARCHAR, LogicalType::VARCHAR},
     {CASS_VALUE_TYPE_VARINT, LogicalType::HUGEINT},
     {CASS_VALUE_TYPE_TIMEUUID, LogicalType::UUID},
-    {CASS_VALUE_TYPE_INET, LogicalType::VARCHAR}, // IP addresses as strings
+    {CASS_VALUE_TYPE_INET, LogicalType::BLOB}, // IP address bytes
     {CASS_VALUE_TYPE_DATE, LogicalType::DATE},
     {CASS_VALUE_TYPE_TIME, LogicalType::TIME},
     {CASS_VALUE_TYPE_SMALL_INT, LogicalType::SMALLINT},
     {CASS_VALUE_TYPE_TINY_INT, LogicalType::TINYINT},
     {CASS_VALUE_TYPE_DURATION, LogicalType::INTERVAL}, // Duration as interval
     
-    // Collection types - map to JSON
-    {CASS_VALUE_TYPE_LIST, LogicalType::JSON()},
-    {CASS_VALUE_TYPE_MAP, LogicalType::JSON()},
-    {CASS_VALUE_TYPE_SET, LogicalType::JSON()},
-    {CASS_VALUE_TYPE_UDT, LogicalType::JSON()}, // User-defined types as JSON
-    {CASS_VALUE_TYPE_TUPLE, LogicalType::JSON()}, // Tuples as JSON
+    // Collections, tuples and UDTs need their element types, see ToDuckDBType
+    {CASS_VALUE_TYPE_LIST, LogicalType::VARCHAR},
+    {CASS_VALUE_TYPE_MAP, LogicalType::VARCHAR},
+    {CASS_VALUE_TYPE_SET, LogicalType::VARCHAR},
+    {CASS_VALUE_TYPE_UDT, LogicalType::VARCHAR},
+    {CASS_VALUE_TYPE_TUPLE, LogicalType::VARCHAR},
     
     // Unknown/custom types
     {CASS_VALUE_TYPE_CUSTOM, LogicalType::VARCHAR},
     {CASS_VALUE_TYPE_UNKNOWN, LogicalType::VARCHAR}
 };
 
-// Static type mapping from Cassandra type strings to DuckDB LogicalType
-const std::unordered_map<std::string, LogicalType> CassandraTypeMapper::type_string_map_ = {
-    // Basic types
-    {"ascii", LogicalType::VARCHAR},
-    {"bigint", LogicalType::BIGINT},
-    {"blob", LogicalType::BLOB},
-    {"boolean", LogicalType::BOOLEAN},
-    {"counter", LogicalType::BIGINT},
-    {"decimal", LogicalType::DECIMAL(38, 10)},
-    {"double", LogicalType::DOUBLE},
-    {"float", LogicalType::FLOAT},
-    {"int", LogicalType::INTEGER},
-    {"text", LogicalType::VARCHAR},
-    {"timestamp", LogicalType::TIMESTAMP_TZ},
-    {"uuid", LogicalType::UUID},
-    {"varchar", LogicalType::VARCHAR},
-    {"varint", LogicalType::HUGEINT},
-    {"timeuuid", LogicalType::UUID},
-    {"inet", LogicalType::VARCHAR},
-    {"date", LogicalType::DATE},
-    {"time", LogicalType::TIME},
-    {"smallint", LogicalType::SMALLINT},
-    {"tinyint", LogicalType::TINYINT},
-    {"duration", LogicalType::INTERVAL},
-    
-    // Collection types - JSON support
-    {"list", LogicalType::JSON()},
-    {"set", LogicalType::JSON()},
-    {"map", LogicalType::JSON()},
-    {"tuple", LogicalType::JSON()},
-    {"frozen", LogicalType::JSON()} // Frozen collections
+// Cassandra type names as they appear in system_schema
+const std::unordered_map<std::string, CassValueType> CassandraTypeMapper::type_string_map_ = {
+    {"ascii", CASS_VALUE_TYPE_ASCII},
+    {"bigint", CASS_VALUE_TYPE_BIGINT},
+    {"blob", CASS_VALUE_TYPE_BLOB},
+    {"boolean", CASS_VALUE_TYPE_BOOLEAN},
+    {"counter", CASS_VALUE_TYPE_COUNTER},
+    {"decimal", CASS_VALUE_TYPE_DECIMAL},
+    {"double", CASS_VALUE_TYPE_DOUBLE},
+    {"float", CASS_VALUE_TYPE_FLOAT},
+    {"int", CASS_VALUE_TYPE_INT},
+    {"text", CASS_VALUE_TYPE_TEXT},
+    {"timestamp", CASS_VALUE_TYPE_TIMESTAMP},
+    {"uuid", CASS_VALUE_TYPE_UUID},
+    {"varchar", CASS_VALUE_TYPE_VARCHAR},
+    {"varint", CASS_VALUE_TYPE_VARINT},
+    {"timeuuid", CASS_VALUE_TYPE_TIMEUUID},
+    {"inet", CASS_VALUE_TYPE_INET},
+    {"date", CASS_VALUE_TYPE_DATE},
+    {"time", CASS_VALUE_TYPE_TIME},
+    {"smallint", CASS_VALUE_TYPE_SMALL_INT},
+    {"tinyint", CASS_VALUE_TYPE_TINY_INT},
+    {"duration", CASS_VALUE_TYPE_DURATION},
+    {"list", CASS_VALUE_TYPE_LIST},
+    {"set", CASS_VALUE_TYPE_SET},
+    {"map", CASS_VALUE_TYPE_MAP},
+    {"tuple", CASS_VALUE_TYPE_TUPLE}
 };
 
-LogicalType CassandraTypeMapper::CassValueTypeToDuckDBType(CassValueType cass_type) {
-    auto it = type_map_.find(cass_type);
-    if (it != type_map_.end()) {
-        return it->second;
-    }
-    
-    std::cerr << "Warning: Unknown Cassandra type " << static_cast<int>(cass_type) 
-              << ", mapping to VARCHAR" << std::endl;
-    return LogicalType::VARCHAR;
-}
+namespace {
 
-LogicalType CassandraTypeMapper::CassandraTypeStringToDuckDBType(const std::string& type_str) {
-    // Handle parameterized types (e.g., "list<text>", "map<text,int>")
-    std::string base_type = type_str;
-    size_t bracket_pos = type_str.find('<');
-    if (bracket_pos != std::string::npos) {
-        base_type = type_str.substr(0, bracket_pos);
+// Recursive descent over system_schema type strings
+class CassandraTypeParser {
+public:
+    CassandraTypeParser(const std::string &type_str, const std::unordered_map<std::string, CassValueType> &names)
+        : type_str(type_str), names(names), pos(0) {
     }
     
-    auto it = type_string_map_.find(base_type);
-    if (it != type_string_map_.end()) {
-        return it->second;
+    CassandraType ParseAll() {
+        auto result = ParseType();
+        SkipSpaces();
+        if (pos != type_str.size()) {
+            throw InvalidInputException("Unexpected '%s' in Cassandra type '%s'", type_str.substr(pos), type_str);
+        }
+        return result;
     }
-    
-    std::cerr << "Warning: Unknown Cassandra type string '" << type_str 
-              << "', mapping to VARCHAR" << std::endl;
-    return LogicalType::VARCHAR;
-}
 
-Value CassandraTypeMapper::CassValueToDuckDBValue(const CassValue* value, const LogicalType& target_type) {
-    if (cass_value_is_null(value)) {
-        return Value(target_type);
+private:
+    void SkipSpaces() {
+        while (pos < type_str.size() && StringUtil::CharacterIsSpace(type_str[pos])) {
+            pos++;
+        }
     }
     
-    CassValueType cass_type = cass_value_type(value);
-    
-    switch (cass_type) {
-        case CASS_VALUE_TYPE_ASCII:
-        case CASS_VALUE_TYPE_TEXT:
-        case CASS_VALUE_TYPE_VARCHAR: {
-            const char* str_val;
-            size_t str_len;
-            cass_value_get_string(value, &str_val, &str_len);
-            return Value(std::string(str_val, str_len));
+    bool Consume(char c) {
+        SkipSpaces();
+        if (pos < type_str.size() && type_str[pos] == c) {
+            pos++;
+            return true;
         }
-        
-        case CASS_VALUE_TYPE_BIGINT:
-        case CASS_VALUE_TYPE_COUNTER: {
-            cass_int64_t int_val;
-            cass_value_get_int64(value, &int_val);
-            return Value::BIGINT(int_val);
-        }
-        
-        case CASS_VALUE_TYPE_INT: {
-            cass_int32_t int_val;
-            cass_value_get_int32(value, &int_val);
-            return Value::INTEGER(int_val);
+        return false;
+    }
+    
+    void Expect(char c) {
+        if (!Consume(c)) {
+            throw InvalidInputException("Expected '%c' in Cassandra type '%s'", c, type_str);
         }
-        
-        case CASS_VALUE_TYPE_SMALL_INT: {
-            cass_int16_t int_val;
-            cass_value_get_int16(value, &int_val);
-            return Value::SMALLINT(int_val);
+    }
+    
+    // Type name, either a bare identifier or a quoted name (custom classes, case sensitive UDTs)
+    std::string ParseName(bool &quoted) {
+        SkipSpaces();
+        quoted = pos < type_str.size() && (type_str[pos] == '"' || type_str[pos] == '\'');
+        if (quoted) {
+            char quote = type_str[pos++];
+            std::string name;
+            while (pos < type_str.size()) {
+                if (type_str[pos] == quote) {
+                    if (pos + 1 < type_str.size() && type_str[pos + 1] == quote) {
+                        name += quote;
+                        pos += 2;
+                        continue;
+                    }
+                    break;
+                }
+                name += type_str[pos++];
+            }
+            Expect(quote);
+            return name;
         }
-        
-        case CASS_VALUE_TYPE_TINY_INT: {
-            cass_int8_t int_val;
-            cass_value_get_int8(value, &int_val);
-            return Value::TINYINT(int_val);
+        auto start = pos;
+        while (pos < type_str.size() && (StringUtil::CharacterIsAlphaNumeric(type_str[pos]) || type_str[pos] == '_' ||
+                                         type_str[pos] == '.')) {
+            pos++;
         }
-        
-        case CASS_VALUE_TYPE_BOOLEAN: {
-            cass_bool_t bool_val;
-            cass_value_get_bool(value, &bool_val);
-            return Value::BOOLEAN(bool_val == cass_true);
+        if (start == pos) {
+            throw InvalidInputException("Expected a type name in Cassandra type '%s'", type_str);
         }
-        
-        case CASS_VALUE_TYPE_FLOAT: {
-            cass_float_t float_val;
-            cass_value_get_float(value, &float_val);
-            return Value::FLOAT(float_val);
+        return StringUtil::Lower(type_str.substr(start, pos - start));
+    }
+    
+    CassandraType ParseType() {
+        bool quoted;
+        auto name = ParseName(quoted);
+        CassandraType result;
+        if (!quoted && name == "frozen") {
+            // Frozen only changes how the value is stored
+            Expect('<');
+            result = ParseType();
+            Expect('>');
+            return result;
         }
-        
-        case CASS_VALUE_TYPE_DOUBLE: {
-            cass_double_t double_val;
-            cass_value_get_double(value, &double_val);
-            return Value::DOUBLE(double_val);
+        if (!quoted && name == "vector") {
+            // vector<element, dimension>, read as a list
+            Expect('<');
+            result.id = CASS_VALUE_TYPE_LIST;
+            result.children.push_back(ParseType());
+            Expect(',');
+            SkipSpaces();
+            while (pos < type_str.size() && StringUtil::CharacterIsDigit(type_str[pos])) {
+                pos++;
+            }
+            Expect('>');
+            return result;
         }
-        
-        case CASS_VALUE_TYPE_TIMESTAMP: {
-            cass_int64_t timestamp_ms;
-            cass_value_get_int64(value, &timestamp_ms);
-            // Convert milliseconds since epoch to DuckDB timestamp
-            auto timestamp_us = timestamp_ms * 1000; // Convert to microseconds
-            return Value::TIMESTAMP(timestamp_t(timestamp_us));
+        auto entry = quoted ? names.end() : names.find(name);
+        if (entry == names.end()) {
+            // Fully qualified Java classes are custom types, anything else names a UDT
+            result.id = name.find('.') != std::string::npos ? CASS_VALUE_TYPE_CUSTOM : CASS_VALUE_TYPE_UDT;
+            result.name = name;
+            return result;
         }
-        
-        case CASS_VALUE_TYPE_DATE: {
-            cass_uint32_t date_val;
-            cass_value_get_uint32(value, &date_val);
-            // Cassandra date is days since epoch (1970-01-01)
-            // DuckDB date is also days since epoch
-            return Value::DATE(date_t(date_val));
+        result.id = entry->second;
+        switch (result.id) {
+            case CASS_VALUE_TYPE_LIST:
+            case CASS_VALUE_TYPE_SET:
+            case CASS_VALUE_TYPE_MAP:
+            case CASS_VALUE_TYPE_TUPLE:
+                Expect('<');
+                do {
+                    result.children.push_back(ParseType());
+                } while (Consume(','));
+                Expect('>');
+                break;
+            default:
+                break;
         }
-        
-        case CASS_VALUE_TYPE_TIME: {
-            cass_int64_t time_val;
-            cass_value_get_int64(value, &time_val);
-            // Cassandra time is nanoseconds since midnight
-            // Convert to DuckDB time (microseconds since midnight)
-            auto time_us = time_val / 1000;
-            return Value::TIME(dtime_t(time_us));
+        idx_t expected = result.id == CASS_VALUE_TYPE_MAP ? 2 : 1;
+        if (result.id != CASS_VALUE_TYPE_TUPLE && !result.children.empty() && result.children.size() != expected) {
+            throw InvalidInputException("Wrong number of element types in Cassandra type '%s'", type_str);
         }
-        
+        return result;
+    }
+    
+    const std::string &type_str;
+    const std::unordered_map<std::string, CassValueType> &names;
+    idx_t pos;
+};
+
+// Scan type of a non-nested Cassandra type
+LogicalType PrimitiveToDuckDBType(CassValueType cass_type, int decimal_scale) {
+    switch (cass_type) {
         case CASS_VALUE_TYPE_UUID:
-        case CASS_VALUE_TYPE_TIMEUUID: {
-            CassUuid uuid_val;
-            cass_value_get_uuid(value, &uuid_val);
-            char uuid_str[CASS_UUID_STRING_LENGTH];
-            cass_uuid_string(uuid_val, uuid_str);
-            return Value::UUID(std::string(uuid_str));
-        }
-        
-        case CASS_VALUE_TYPE_INET: {
-            CassInet inet_val;
-            cass_value_get_inet(value, &inet_val);
-            char inet_str[CASS_INET_STRING_LENGTH];
-            cass_inet_string(inet_val, inet_str);
-            return Value(std::string(inet_str));
-        }
-        
-        case CASS_VALUE_TYPE_BLOB: {
-            const cass_byte_t* blob_val;
-            size_t blob_size;
-            cass_value_get_bytes(value, &blob_val, &blob_size);
-            return Value::BLOB(blob_val, blob_size);
-        }
-        
-        // Collection types - convert to JSON
+        case CASS_VALUE_TYPE_TIMEUUID:
+            return LogicalType::UUID;
+        case CASS_VALUE_TYPE_TIMESTAMP:
+            return LogicalType::TIMESTAMP_TZ;
+        case CASS_VALUE_TYPE_DOUBLE:
+            return LogicalType::DOUBLE;
+        case CASS_VALUE_TYPE_INT:
+            return LogicalType::INTEGER;
+        case CASS_VALUE_TYPE_BIGINT:
+        case CASS_VALUE_TYPE_COUNTER:
+            return LogicalType::BIGINT;
+        case CASS_VALUE_TYPE_BOOLEAN:
+            return LogicalType::BOOLEAN;
+        case CASS_VALUE_TYPE_FLOAT:
+            return LogicalType::FLOAT;
+        case CASS_VALUE_TYPE_SMALL_INT:
+            return LogicalType::SMALLINT;
+        case CASS_VALUE_TYPE_TINY_INT:
+            return LogicalType::TINYINT;
+        case CASS_VALUE_TYPE_DATE:
+            return LogicalType::DATE;
+        case CASS_VALUE_TYPE_TIME:
+            return LogicalType::TIME;
+        case CASS_VALUE_TYPE_BLOB:
+        case CASS_VALUE_TYPE_INET:               // Address bytes: 4 for IPv4, 16 for IPv6
+            return LogicalType::BLOB;
+        case CASS_VALUE_TYPE_DURATION:
+            return LogicalType::INTERVAL;
+        case CASS_VALUE_TYPE_DECIMAL:
+            // Decimals carry their own scale per value, only text holds every one of them exactly
+            if (decimal_scale < 0) {
+                return LogicalType::VARCHAR;
+            }
+            if (decimal_scale > Decimal::MAX_WIDTH_INT128) {
+                throw InvalidInputException("decimal_scale must be between 0 and %d", Decimal::MAX_WIDTH_INT128);
+            }
+            return LogicalType::DECIMAL(Decimal::MAX_WIDTH_INT128, NumericCast<uint8_t>(decimal_scale));
+        case CASS_VALUE_TYPE_VARINT:
+            return LogicalType::HUGEINT;
+        default:
+            return LogicalType::VARCHAR;
+    }
+}
+
+} // namespace
+
+CassandraType CassandraType::Parse(const std::string &type_str) {
+    return CassandraTypeParser(type_str, CassandraTypeMapper::type_string_map_).ParseAll();
+}
+
+CassandraType CassandraType::FromDataType(const CassDataType* data_type) {
+    CassandraType result;
+    if (!data_type) {
+        return result;
+    }
+    result.id = cass_data_type_type(data_type);
+    const char* name;
+    size_t name_length;
+    switch (result.id) {
+        case CASS_VALUE_TYPE_UDT:
+            if (cass_data_type_type_name(data_type, &name, &name_length) == CASS_OK) {
+                result.name = std::string(name, name_length);
+            }
+            for (size_t i = 0; i < cass_data_type_sub_type_count(data_type); i++) {
+                if (cass_data_type_sub_type_name(data_type, i, &name, &name_length) != CASS_OK) {
+                    name_length = 0;
+                }
+                result.field_names.push_back(std::string(name, name_length));
+                result.children.push_back(FromDataType(cass_data_type_sub_data_type(data_type, i)));
+            }
+            break;
         case CASS_VALUE_TYPE_LIST:
         case CASS_VALUE_TYPE_SET:
         case CASS_VALUE_TYPE_MAP:
-        case CASS_VALUE_TYPE_UDT:
-        case CASS_VALUE_TYPE_TUPLE: {
-            // TODO: Implement proper JSON serialization from CassValue
-            // For now, return a JSON placeholder - this will be enhanced later
-            return Value("{\"type\": \"" + GetCassandraTypeName(cass_type) + "\", \"data\": \"<collection>\"}");
-        }
-        
-        default: {
-            std::cerr << "Warning: Unsupported Cassandra value type " << static_cast<int>(cass_type)
-                      << ", returning NULL" << std::endl;
-            return Value(target_type);
+        case CASS_VALUE_TYPE_TUPLE:
+            for (size_t i = 0; i < cass_data_type_sub_type_count(data_type); i++) {
+                result.children.push_back(FromDataType(cass_data_type_sub_data_type(data_type, i)));
+            }
+            break;
+        case CASS_VALUE_TYPE_CUSTOM:
+            if (cass_data_type_class_name(data_type, &name, &name_length) == CASS_OK) {
+                result.name = std::string(name, name_length);
+            }
+            break;
+        default:
+            break;
+    }
+    return result;
+}
+
+LogicalType CassandraTypeMapper::CassValueTypeToDuckDBType(CassValueType cass_type) {
+    auto it = type_map_.find(cass_type);
+    if (it != type_map_.end()) {
+        return it->second;
+    }
+    
+    std::cerr << "Warning: Unknown Cassandra type " << static_cast<int>(cass_type) 
+              << ", mapping to VARCHAR" << std::endl;
+    return LogicalType::VARCHAR;
+}
+
+LogicalType CassandraTypeMapper::CassandraTypeStringToDuckDBType(const std::string& type_str) {
+    return ToDuckDBType(CassandraType::Parse(type_str));
+}
+
+LogicalType CassandraTypeMapper::ToDuckDBType(const CassandraType &type, int decimal_scale) {
+    switch (type.id) {
+        case CASS_VALUE_TYPE_LIST:
+        case CASS_VALUE_TYPE_SET:
+            if (type.children.size() != 1) {
+                return LogicalType::VARCHAR;
+            }
+            return LogicalType::LIST(ToDuckDBType(type.children[0], decimal_scale));
+        case CASS_VALUE_TYPE_MAP:
+            if (type.children.size() != 2) {
+                return LogicalType::VARCHAR;
+            }
+            return LogicalType::MAP(ToDuckDBType(type.children[0], decimal_scale),
+                                    ToDuckDBType(type.children[1], decimal_scale));
+        case CASS_VALUE_TYPE_TUPLE:
+        case CASS_VALUE_TYPE_UDT: {
+            if (type.children.empty()) {
+                return LogicalType::VARCHAR;
+            }
+            // Tuple fields are positional, name them _1, _2, ...
+            child_list_t<LogicalType> fields;
+            for (idx_t i = 0; i < type.children.size(); i++) {
+                auto field_name = i < type.field_names.size() ? type.field_names[i] : "_" + std::to_string(i + 1);
+                fields.push_back(make_pair(field_name, ToDuckDBType(type.children[i], decimal_scale)));
+            }
+            return LogicalType::STRUCT(std::move(fields));
         }
+        default:
+            return PrimitiveToDuckDBType(type.id, decimal_scale);
     }
 }
 
+Value CassandraTypeMapper::CassValueToDuckDBValue(const CassValue* value, const LogicalType& target_type) {
+    if (cass_value_is_null(value)) {
+        return Value(target_type);
+    }
+    // Decoded like a scanned cell, so collections, tuples and UDTs become the LIST, MAP and
+    // STRUCT values ToDuckDBType gives their columns
+    auto cass_type = CassandraType::FromDataType(cass_value_data_type(value));
+    auto decoder = CassandraDecoder::GetDecoder(cass_type, target_type, false);
+    Vector result(target_type, 1);
+    if (!decoder.decode_value(decoder, value, result, 0)) {
+        throw InvalidInputException("Cannot read Cassandra %s value as %s", GetCassandraTypeName(cass_type.id),
+                                    target_type.ToString());
+    }
+    return result.GetValue(0);
+}
+
 std::string CassandraTypeMapper::GetCassandraTypeName(CassValueType cass_type) {
     switch (cass_type) {
         case CASS_VALUE_TYPE_ASCII: return "ascii";
@@ -264,5 +394,57 @@ std::string CassandraTypeMapper::GetCassandraTypeName(CassValueType cass_type) {
     }
 }
 
+std::string CassandraTypeMapper::ToCQLType(const LogicalType &type, bool frozen) {
+    // Only types the writer can encode are mapped
+    switch (type.id()) {
+        case LogicalTypeId::BOOLEAN: return "boolean";
+        case LogicalTypeId::TINYINT: return "tinyint";
+        case LogicalTypeId::SMALLINT: return "smallint";
+        case LogicalTypeId::INTEGER: return "int";
+        case LogicalTypeId::BIGINT: return "bigint";
+        case LogicalTypeId::HUGEINT: return "varint";
+        case LogicalTypeId::FLOAT: return "float";
+        case LogicalTypeId::DOUBLE: return "double";
+        case LogicalTypeId::DECIMAL: return "decimal";
+        case LogicalTypeId::VARCHAR: return "text";
+        case LogicalTypeId::BLOB: return "blob";
+        case LogicalTypeId::DATE: return "date";
+        case LogicalTypeId::TIME: return "time";
+        case LogicalTypeId::TIMESTAMP:
+        case LogicalTypeId::TIMESTAMP_TZ: return "timestamp";
+        case LogicalTypeId::INTERVAL: return "duration";
+        case LogicalTypeId::UUID: return "uuid";
+        case LogicalTypeId::LIST: {
+            auto result = "list<" + ToCQLType(ListType::GetChildType(type), true) + ">";
+            return frozen ? "frozen<" + result + ">" : result;
+        }
+        case LogicalTypeId::MAP: {
+            auto result = "map<" + ToCQLType(MapType::KeyType(type), true) + ", " +
+                          ToCQLType(MapType::ValueType(type), true) + ">";
+            return frozen ? "frozen<" + result + ">" : result;
+        }
+        case LogicalTypeId::STRUCT: {
+            // Tuples have no field names, so only positional structs, the way tuples are read, map
+            // to them. Named fields would be dropped without a word.
+            std::string fields;
+            for (idx_t i = 0; i < StructType::GetChildCount(type); i++) {
+                if (!StructType::IsUnnamed(type) && StructType::GetChildName(type, i) != "_" + std::to_string(i + 1)) {
+                    throw NotImplementedException(
+                        "Cannot create a Cassandra column of type %s: Cassandra tuples have no field names. Create a "
+                        "user-defined type in Cassandra and the table there, or name the fields _1, _2, ... to store "
+                        "a tuple",
+                        type.ToString());
+                }
+                fields += (i > 0 ? ", " : "") + ToCQLType(StructType::GetChildType(type, i), true);
+            }
+            // Tuples are always frozen
+            return "frozen<tuple<" + fields + ">>";
+        }
+        default:
+            throw NotImplementedException("Cannot create a Cassandra column of type %s, cast it to a supported type",
+                                          type.ToString());
+    }
+}
+
 } // namespace cassandra
 } // namespace duckdb
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "cassandra_utils.hpp"
+#include "cassandra_settings.hpp"
 #include "storage/cassandra_catalog.hpp"
 #include "storage/cassandra_transaction.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
@@ -8,7 +9,11 @@ namespace duckdb {
 namespace cassandra {
 
 CassandraConfig CassandraConfig::FromConnectionString(const std::string& connection_string) {
-    CassandraConfig config;
+    return FromConnectionString(connection_string, CassandraConfig());
+}
+
+CassandraConfig CassandraConfig::FromConnectionString(const std::string& connection_string, const CassandraConfig &base) {
+    CassandraConfig config = base;
     
     // Parse connection string format: host=127.0.0.1 port=9042 keyspace=test username=user password=pass certfile=hex userkey=hex usercert=hex
     std::stringstream ss(connection_string);
@@ -32,6 +37,44 @@ CassandraConfig CassandraConfig::FromConnectionString(const std::string& connect
                 config.password = value;
             } else if (key == "consistency") {
                 config.consistency = value;
+            } else if (key == "serial_consistency") {
+                config.serial_consistency = value;
+            } else if (key == "io_threads") {
+                config.io_threads = std::stoi(value);
+            } else if (key == "core_connections") {
+                config.core_connections_per_host = std::stoi(value);
+            } else if (key == "queue_size") {
+                config.queue_size_io = std::stoi(value);
+            } else if (key == "request_timeout") {
+                config.request_timeout_ms = std::stoi(value);
+            } else if (key == "connect_timeout") {
+                config.connect_timeout_ms = std::stoi(value);
+            } else if (key == "tcp_nodelay") {
+                config.tcp_nodelay = (value == "true" || value == "1" || value == "on");
+            } else if (key == "tcp_keepalive") {
+                config.tcp_keepalive_secs = std::stoi(value);
+            } else if (key == "coalesce_delay") {
+                config.coalesce_delay_us = std::stoll(value);
+            } else if (key == "page_size") {
+                config.page_size = std::stoi(value);
+            } else if (key == "local_dc") {
+                config.local_dc = value;
+            } else if (key == "token_aware") {
+                config.token_aware = (value == "true" || value == "1" || value == "on");
+            } else if (key == "write_concurrency") {
+                config.write_concurrency = std::stoi(value);
+            } else if (key == "write_batch_size") {
+                config.write_batch_size = std::stoi(value);
+            } else if (key == "write_retries") {
+                config.write_retries = std::stoi(value);
+            } else if (key == "write_rate") {
+                config.write_rate = std::stoll(value);
+            } else if (key == "decimal_scale") {
+                config.decimal_scale = std::stoi(value);
+            } else if (key == "statistics_ttl") {
+                config.statistics_ttl = std::stoi(value);
+            } else if (key == "statistics_sample_rows") {
+                config.statistics_sample_rows = std::stoi(value);
             } else if (key == "ssl" || key == "use_ssl") {
                 config.use_ssl = (value == "true" || value == "1" || value == "on");
             } else if (key == "certfile") {
@@ -118,10 +161,23 @@ bool CassandraConfig::HasSSLConfig() const {
                        !certfile_b64.empty() || !usercert_b64.empty());
 }
 
+std::string QuoteCQLIdentifier(const std::string& identifier) {
+    std::string result = "\"";
+    for (char c : identifier) {
+        if (c == '"') {
+            result += '"';
+        }
+        result += c;
+    }
+    return result + "\"";
+}
+
 unique_ptr<Catalog> CassandraAttachCatalog(optional_ptr<StorageExtensionInfo> storage_info,
                                            ClientContext &context, AttachedDatabase &db, const string &name,
                                            AttachInfo &info, AttachOptions &options) {
-    auto config = CassandraConfig::FromConnectionString(info.path);
+    CassandraConfig defaults;
+    CassandraSettings::ApplyToConfig(context, defaults);
+    auto config = CassandraConfig::FromConnectionString(info.path, defaults);
     auto catalog = make_uniq<CassandraCatalog>(db, name, info.path, options.access_mode, config);
     return catalog;
 }
@@ -0,0 +1,382 @@
+#include "cassandra_writer.hpp"
+#include "cassandra_client.hpp"
+#include "cassandra_token_ranges.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <thread>
+
+namespace duckdb {
+namespace cassandra {
+
+// Delay before the first retry of a failed write, doubled for every further attempt up to
+// 2^CASSANDRA_WRITE_RETRY_MAX_SHIFT times as long
+static constexpr int64_t CASSANDRA_WRITE_RETRY_DELAY_MS = 100;
+static constexpr int CASSANDRA_WRITE_RETRY_MAX_SHIFT = 6;
+
+// Errors after which the write may or may not have been applied, or was refused for now
+static bool IsRetryableWriteError(CassError error) {
+    switch (error) {
+        case CASS_ERROR_LIB_REQUEST_TIMED_OUT:
+        case CASS_ERROR_LIB_NO_HOSTS_AVAILABLE:
+        case CASS_ERROR_LIB_REQUEST_QUEUE_FULL:
+        case CASS_ERROR_LIB_WRITE_ERROR:
+        case CASS_ERROR_SERVER_WRITE_TIMEOUT:
+        case CASS_ERROR_SERVER_UNAVAILABLE:
+        case CASS_ERROR_SERVER_OVERLOADED:
+        case CASS_ERROR_SERVER_IS_BOOTSTRAPPING:
+            return true;
+        default:
+            return false;
+    }
+}
+
+CassandraWriteTarget::CassandraWriteTarget(shared_ptr<CassandraClient> client_p, const CassandraTableRef &table_ref,
+                                           CassandraWriteType type, vector<string> column_names_p,
+                                           vector<LogicalType> column_types_p,
+                                           const vector<string> &partition_key_names,
+                                           const vector<string> &clustering_key_names, const CassandraConfig &options)
+    : client(std::move(client_p)), table_ref(table_ref), type(type), column_names(std::move(column_names_p)),
+      column_types(std::move(column_types_p)), options(options), in_flight(0), rows_written(0), requests(0),
+      retries(0), timeouts(0) {
+    // Cassandra names are case sensitive once quoted
+    unordered_map<string, idx_t> positions;
+    for (idx_t i = 0; i < column_names.size(); i++) {
+        positions[column_names[i]] = i;
+    }
+    auto find_key = [&](const string &name) {
+        auto entry = positions.find(name);
+        if (entry == positions.end()) {
+            throw InvalidInputException("Writes into Cassandra table %s must set primary key column \"%s\"",
+                                        table_ref.GetQualifiedName(), name);
+        }
+        primary_key.push_back(entry->second);
+        return entry->second;
+    };
+    for (auto &name : partition_key_names) {
+        partition_key.push_back(find_key(name));
+    }
+    for (auto &name : clustering_key_names) {
+        find_key(name);
+    }
+
+    string query;
+    parameters.resize(column_names.size());
+    if (type == CassandraWriteType::INSERT_ROWS) {
+        string columns;
+        string markers;
+        for (idx_t i = 0; i < column_names.size(); i++) {
+            columns += (columns.empty() ? "" : ", ") + QuoteCQLIdentifier(column_names[i]);
+            markers += markers.empty() ? "?" : ", ?";
+            parameters[i] = i;
+        }
+        query = "INSERT INTO " + table_ref.GetQualifiedName() + " (" + columns + ") VALUES (" + markers + ")";
+    } else {
+        // The other columns are set, the primary key goes into the WHERE clause after them
+        string assignments;
+        idx_t parameter = 0;
+        for (idx_t i = 0; i < column_names.size(); i++) {
+            if (std::find(primary_key.begin(), primary_key.end(), i) != primary_key.end()) {
+                continue;
+            }
+            if (type == CassandraWriteType::DELETE_ROWS) {
+                throw InternalException("DELETE from %s only takes primary key columns", table_ref.GetQualifiedName());
+            }
+            assignments += (assignments.empty() ? "" : ", ") + QuoteCQLIdentifier(column_names[i]) + " = ?";
+            parameters[i] = parameter++;
+        }
+        string condition;
+        for (auto column : primary_key) {
+            condition += (condition.empty() ? "" : " AND ") + QuoteCQLIdentifier(column_names[column]) + " = ?";
+            parameters[column] = parameter++;
+        }
+        if (type == CassandraWriteType::UPDATE_ROWS) {
+            if (assignments.empty()) {
+                throw InternalException("UPDATE of %s sets no columns", table_ref.GetQualifiedName());
+            }
+            query = "UPDATE " + table_ref.GetQualifiedName() + " SET " + assignments + " WHERE " + condition;
+        } else {
+            query = "DELETE FROM " + table_ref.GetQualifiedName() + " WHERE " + condition;
+        }
+    }
+    prepared = client->GetPrepared(query);
+    for (idx_t i = 0; i < column_names.size(); i++) {
+        encoders.push_back(CassandraEncoder::GetEncoder(
+            cass_prepared_parameter_data_type(prepared.get(), parameters[i]), column_types[i]));
+    }
+}
+
+void CassandraWriteTarget::Throttle(idx_t rows) {
+    // Requests are spaced out over all writers so the rows sent per second stay at write_rate
+    auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(static_cast<double>(rows) / static_cast<double>(options.write_rate)));
+    std::chrono::steady_clock::time_point slot;
+    {
+        std::lock_guard<std::mutex> guard(rate_lock);
+        // Time spent idle does not add up to a burst later
+        slot = MaxValue(next_send, std::chrono::steady_clock::now());
+        next_send = slot + interval;
+    }
+    std::this_thread::sleep_until(slot);
+}
+
+CassandraWriter::CassandraWriter(shared_ptr<CassandraWriteTarget> target_p) : target(std::move(target_p)) {
+}
+
+CassandraWriter::~CassandraWriter() {
+    // Requests still pending after an error are abandoned, the driver completes them on its own.
+    // Those waiting to be retried are not in flight.
+    for (auto &request : pending) {
+        if (request.future) {
+            target->in_flight--;
+        }
+        FreeRequest(request);
+    }
+    FreeStatements();
+}
+
+void CassandraWriter::FreeRequest(PendingRequest &request) {
+    if (request.future) {
+        cass_future_free(request.future);
+    }
+    request.session.reset();
+    if (request.statement) {
+        cass_statement_free(request.statement);
+    }
+    if (request.batch) {
+        cass_batch_free(request.batch);
+    }
+}
+
+void CassandraWriter::FreeStatements() {
+    for (auto statement : statements) {
+        if (statement) {
+            cass_statement_free(statement);
+        }
+    }
+    statements.clear();
+}
+
+void CassandraWriter::Append(DataChunk &chunk) {
+    auto count = chunk.size();
+    if (count == 0) {
+        return;
+    }
+    auto &options = target->options;
+
+    for (auto column : target->primary_key) {
+        UnifiedVectorFormat format;
+        chunk.data[column].ToUnifiedFormat(count, format);
+        if (format.validity.AllValid()) {
+            continue;
+        }
+        for (idx_t i = 0; i < count; i++) {
+            if (!format.validity.RowIsValid(format.sel->get_index(i))) {
+                throw ConstraintException("NOT NULL constraint failed: %s.%s", target->table_ref.GetQualifiedName(),
+                                          target->column_names[column]);
+            }
+        }
+    }
+
+    // One statement per row, bound a column at a time
+    FreeStatements();
+    statements.resize(count, nullptr);
+    for (idx_t i = 0; i < count; i++) {
+        statements[i] = cass_prepared_bind(target->prepared.get());
+    }
+    for (idx_t column = 0; column < chunk.ColumnCount(); column++) {
+        RecursiveUnifiedVectorFormat format;
+        Vector::RecursiveToUnifiedFormat(chunk.data[column], count, format);
+        auto &encoder = target->encoders[column];
+        auto parameter = target->parameters[column];
+        auto error = encoder.encode(encoder, format, count, statements.data(), parameter);
+        if (error == CASS_OK && target->type == CassandraWriteType::UPDATE_ROWS &&
+            !format.unified.validity.AllValid()) {
+            // Setting NULL clears the column, unlike in an INSERT where it is left unset
+            for (idx_t i = 0; i < count && error == CASS_OK; i++) {
+                if (!format.unified.validity.RowIsValid(format.unified.sel->get_index(i))) {
+                    error = cass_statement_bind_null(statements[i], parameter);
+                }
+            }
+        }
+        if (error != CASS_OK) {
+            throw InvalidInputException("Cannot write column \"%s\" of %s: %s", target->column_names[column],
+                                        target->table_ref.GetQualifiedName(), cass_error_desc(error));
+        }
+    }
+
+    // Rows of the same partition are sent together, grouped by the token of their partition key,
+    // which is also the routing key of their request
+    vector<idx_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    bool by_token = options.write_batch_size > 1 && ComputeTokens(chunk);
+    if (by_token) {
+        std::sort(order.begin(), order.end(), [&](idx_t a, idx_t b) {
+            return tokens[a] < tokens[b] || (tokens[a] == tokens[b] && a < b);
+        });
+    }
+
+    auto batch_size = NumericCast<idx_t>(MaxValue<int>(options.write_batch_size, 1));
+    idx_t start = 0;
+    while (start < count) {
+        idx_t end = start + 1;
+        while (by_token && end < count && end - start < batch_size && tokens[order[end]] == tokens[order[start]]) {
+            end++;
+        }
+        if (by_token) {
+            // A batch is routed by the key of its first statement
+            auto &key = keys[order[start]];
+            cass_statement_set_routing_key(statements[order[start]], key.c_str(), key.size());
+        }
+        PendingRequest request;
+        request.rows = end - start;
+        if (request.rows == 1) {
+            request.statement = statements[order[start]];
+            statements[order[start]] = nullptr;
+            cass_statement_set_is_idempotent(request.statement, cass_true);
+            CassandraClient::ConfigureStatement(request.statement, options);
+        } else {
+            request.batch = cass_batch_new(CASS_BATCH_TYPE_UNLOGGED);
+            cass_batch_set_is_idempotent(request.batch, cass_true);
+            CassandraClient::ConfigureBatch(request.batch, options);
+            for (idx_t i = start; i < end; i++) {
+                // The batch keeps its own reference to the statement
+                cass_batch_add_statement(request.batch, statements[order[i]]);
+                cass_statement_free(statements[order[i]]);
+                statements[order[i]] = nullptr;
+            }
+        }
+        Send(request);
+        start = end;
+    }
+    statements.clear();
+}
+
+bool CassandraWriter::ComputeTokens(DataChunk &chunk) {
+    auto count = chunk.size();
+    auto &partition_key = target->partition_key;
+    if (partition_key.empty()) {
+        return false;
+    }
+    // Rows of a frozen collection, tuple or UDT key are sent one by one, the driver routes each
+    for (auto column : partition_key) {
+        if (!target->encoders[column].serialize) {
+            return false;
+        }
+    }
+    keys.assign(count, string());
+    tokens.resize(count);
+    for (auto column : partition_key) {
+        UnifiedVectorFormat format;
+        chunk.data[column].ToUnifiedFormat(count, format);
+        for (idx_t i = 0; i < count; i++) {
+            if (!CassandraEncoder::SerializeKeyComponent(target->encoders[column], format, format.sel->get_index(i),
+                                                         partition_key.size() > 1, keys[i])) {
+                return false;
+            }
+        }
+    }
+    for (idx_t i = 0; i < count; i++) {
+        tokens[i] = CassandraTokenRanges::GetToken(const_data_ptr_cast(keys[i].data()), keys[i].size());
+    }
+    return true;
+}
+
+void CassandraWriter::Send(PendingRequest request) {
+    // Requests of other writers may fill the limit, then this one sends anyway rather than wait for nothing
+    auto limit = NumericCast<idx_t>(MaxValue<int>(target->options.write_concurrency, 1));
+    try {
+        while (!pending.empty() && target->in_flight >= limit) {
+            WaitOldest();
+        }
+        if (target->options.write_rate > 0) {
+            target->Throttle(request.rows);
+        }
+    } catch (...) {
+        FreeRequest(request);
+        throw;
+    }
+    pending.push_back(request);
+    target->in_flight++;
+    Execute(pending.back());
+}
+
+void CassandraWriter::Execute(PendingRequest &request) {
+    request.session = target->client->GetSession();
+    request.future = request.batch ? cass_session_execute_batch(request.session.get(), request.batch)
+                                   : cass_session_execute(request.session.get(), request.statement);
+    request.attempts++;
+    target->requests++;
+}
+
+void CassandraWriter::WaitOldest() {
+    auto &oldest = pending.front();
+    if (oldest.future) {
+        Complete(0);
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (oldest.retry_at <= now) {
+        target->in_flight++;
+        Execute(oldest);
+        return;
+    }
+    // While the oldest waits for its retry, the younger ones in flight are waited for
+    for (idx_t i = 1; i < pending.size(); i++) {
+        if (pending[i].future) {
+            auto timeout = std::chrono::duration_cast<std::chrono::microseconds>(oldest.retry_at - now);
+            if (cass_future_wait_timed(pending[i].future, NumericCast<cass_duration_t>(timeout.count()))) {
+                Complete(i);
+            }
+            return;
+        }
+    }
+    // Nothing else is in flight, so there is nothing to do until the retry is due
+    std::this_thread::sleep_until(oldest.retry_at);
+}
+
+void CassandraWriter::Complete(idx_t index) {
+    auto &request = pending[index];
+    auto error = cass_future_error_code(request.future);
+    target->in_flight--;
+    if (error == CASS_OK) {
+        target->rows_written += request.rows;
+        FreeRequest(request);
+        pending.erase(pending.begin() + NumericCast<int64_t>(index));
+        return;
+    }
+    if (error == CASS_ERROR_LIB_REQUEST_TIMED_OUT || error == CASS_ERROR_SERVER_WRITE_TIMEOUT) {
+        target->timeouts++;
+    }
+    if (IsRetryableWriteError(error) && request.attempts <= target->options.write_retries) {
+        // Rows are written with values rather than increments, so resending one whose outcome is
+        // unknown is safe. It keeps its place and is sent again once its delay has passed.
+        target->retries++;
+        cass_future_free(request.future);
+        request.future = nullptr;
+        request.session.reset();
+        auto shift = MinValue(request.attempts - 1, CASSANDRA_WRITE_RETRY_MAX_SHIFT);
+        request.retry_at =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(CASSANDRA_WRITE_RETRY_DELAY_MS << shift);
+        target->client->ReportError(error);
+        return;
+    }
+    auto message = CassandraClient::GetErrorMessage(request.future);
+    auto rows = request.rows;
+    auto attempts = request.attempts;
+    FreeRequest(request);
+    pending.erase(pending.begin() + NumericCast<int64_t>(index));
+    target->client->ReportError(error);
+    throw IOException("Failed to write %d rows into %s after %d attempts: %s", rows,
+                      target->table_ref.GetQualifiedName(), attempts, message);
+}
+
+void CassandraWriter::Flush() {
+    while (!pending.empty()) {
+        WaitOldest();
+    }
+}
+
+} // namespace cassandra
+} // namespace duckdb
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+
+namespace duckdb {
+namespace cassandra {
+
+// cassandra_prepared_cache_stats('<attached catalog>'): hit/miss counters of the catalog's client
+class CassandraPreparedCacheStatsFunction : public TableFunction {
+public:
+    CassandraPreparedCacheStatsFunction();
+};
+
+} // namespace cassandra
+} // namespace duckdb
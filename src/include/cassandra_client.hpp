@@ -1,12 +1,19 @@
 #pragma once
 
+#include "cassandra_token_ranges.hpp"
+#include "cassandra_types.hpp"
 #include "cassandra_utils.hpp"
 #include "duckdb.hpp"
 #include "duckdb/parser/column_list.hpp"
 #include "duckdb/parser/constraint.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 
+#include <chrono>
 #include <iostream>
+#include <list>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // DataStax C++ driver headers
@@ -15,6 +22,29 @@
 namespace duckdb {
 namespace cassandra {
 
+// Counters of the prepared statement cache
+struct CassandraPreparedCacheStats {
+    idx_t hits = 0;
+    idx_t misses = 0;
+    idx_t entries = 0;
+    idx_t capacity = 0;
+};
+
+// Estimated size of a table and statistics of its key columns
+struct CassandraTableStatistics {
+    // Per-range estimates of the coordinator, used to split scans
+    vector<CassandraSizeEstimate> estimates;
+    CassandraTableSize size;
+    // Estimated number of rows (0 = unknown)
+    idx_t rows = 0;
+    // Estimated number of distinct values of key columns by column name, only for the columns
+    // an estimate exists for
+    unordered_map<string, idx_t> distinct_counts;
+    
+    // Statistics of a column; key columns are never NULL. nullptr if nothing is known.
+    unique_ptr<BaseStatistics> GetColumnStatistics(const string &column_name, const LogicalType &type) const;
+};
+
 class CassandraClient {
 public:
     explicit CassandraClient(const CassandraConfig &config);
@@ -31,38 +61,120 @@ public:
     bool TableExists(const string &keyspace_name, const string &table_name);
     
     void CreateKeyspace(const CreateSchemaInfo &info, const CassandraKeyspaceRef &keyspace_ref);
-    void CreateTable(const CreateTableInfo &info, const CassandraTableRef &table_ref);
+    // Create the table with the columns of info and the given primary key, then wait until the
+    // nodes agree on the new schema and the driver's schema metadata has the table
+    void CreateTable(ClientContext &context, const CreateTableInfo &info, const CassandraTableRef &table_ref,
+                     const vector<string> &partition_key, const vector<string> &clustering_key,
+                     const vector<bool> &clustering_descending);
     
     void DropKeyspace(const DropInfo &info);
     void DropTable(const DropInfo &info);
     
-    void GetTableInfo(const string &keyspace_name,
-                      const string &table_name,
-                      ColumnList &res_columns,
-                      vector<unique_ptr<Constraint>> &res_constraints);
+    // Version of the driver's schema metadata snapshot, changes whenever the schema does
+    uint32_t GetSchemaVersion();
+    
+    // Keyspace names known to the driver's schema metadata
+    vector<string> GetKeyspaceNames();
+    
+    // Stored name and table names of a keyspace from the schema metadata. Returns false if
+    // the keyspace does not exist.
+    bool GetKeyspaceMetadata(const string &keyspace_name, string &name, vector<string> &table_names);
+    
+    // Columns and keys of a table from the schema metadata the driver keeps in memory, so no
+    // request is sent. Returns false if the table does not exist.
+    bool GetTableSchema(const string &keyspace_name, const string &table_name, CassandraTableSchema &result);
+    
+    // Per-range size estimates from system.size_estimates of the coordinator node. Estimates are
+    // only a hint, a failure to read them is logged to context and leaves the result empty.
+    vector<CassandraSizeEstimate> GetSizeEstimates(ClientContext &context, const string &keyspace_name,
+                                                   const string &table_name);
+    
+    // Size estimates and key column statistics of a table. Sampling and caching follow the
+    // statistics settings of options, which may differ between users of a pooled client.
+    shared_ptr<const CassandraTableStatistics> GetTableStatistics(ClientContext &context,
+                                                                  const CassandraTableRef &table_ref,
+                                                                  const vector<string> &partition_key,
+                                                                  const vector<string> &clustering_key,
+                                                                  const CassandraConfig &options);
     
     // Execute CQL query and return results
     unique_ptr<QueryResult> ExecuteQuery(const string &query);
     
-    // Get access to the session for direct query execution (with connection recovery)
-    CassSession* GetSession();
+    // Current session for direct query execution. Callers hold on to it until their request has
+    // completed; when it has failed, requests report their error through ReportError and a new
+    // session replaces it for the requests that follow.
+    shared_ptr<CassSession> GetSession();
+    
+    // Create a statement from the cached prepared form of query, preparing it on first use.
+    // The caller owns the returned statement.
+    CassStatement* NewStatement(const string &query);
     
-    // Connection recovery methods
-    bool IsConnected() const;
+    // Cached prepared form of query, preparing it on first use. Writers bind many rows from it
+    // without going through the cache for every statement.
+    shared_ptr<const CassPrepared> GetPrepared(const string &query);
+    
+    // Apply the per-request options of options (consistency, timeout, page size) to statement.
+    // They are set per statement because a pooled client is shared by callers with different options.
+    static void ConfigureStatement(CassStatement* statement, const CassandraConfig &options);
+    // Same for a batch, whose own settings replace those of the statements in it
+    static void ConfigureBatch(CassBatch* batch, const CassandraConfig &options);
+    
+    // Execute statement and wait for it; the statement is freed. A failure throws an
+    // IOException naming query.
+    void ExecuteStatement(CassStatement* statement, const string &query);
+    
+    CassandraPreparedCacheStats GetPreparedCacheStats() const;
+    
+    // Replace the session with a freshly connected one
     void ResetConnection();
+    
+    // Reconnect if a request failed because no node could be reached. Throws a ConnectionException
+    // if the reconnect fails as well.
+    void ReportError(CassError error_code);
+    
+    // Extract the error message from a failed future
+    static std::string GetErrorMessage(CassFuture* future);
 
 private:
     CassandraConfig config;
-    // DataStax C++ driver objects
-    CassCluster* cluster;
-    CassSession* session;
+    // DataStax C++ driver session; closed and freed with its cluster once no request holds it
+    std::mutex session_mutex;
+    shared_ptr<CassSession> session;
+    
+    // Execute a CREATE, ALTER or DROP statement and wait for schema agreement. Nodes that do not
+    // agree in time are logged to context as a warning, the change itself went through.
+    void ExecuteSchemaChange(ClientContext &context, const string &query);
+    // Whether the coordinator and every peer it knows of report the same schema version
+    bool SchemaInAgreement();
+    
+    // Connect a session with a cluster of its own, configured from config
+    shared_ptr<CassSession> NewSession();
+    // Configure cluster and connect target with it
+    void Connect(CassCluster* cluster, CassSession* target);
+    
+    // Serializes reconnects only
+    std::mutex connection_mutex;
+    
+    // LRU cache of prepared statements keyed by CQL text, most recently used first
+    void ClearPreparedCache();
+    
+    mutable std::mutex prepared_mutex;
+    std::list<std::pair<string, shared_ptr<const CassPrepared>>> prepared_lru;
+    std::unordered_map<string, std::list<std::pair<string, shared_ptr<const CassPrepared>>>::iterator> prepared_index;
+    idx_t prepared_hits = 0;
+    idx_t prepared_misses = 0;
     
-    void Connect();
-    void Disconnect();
+    // Sample the key columns to estimate rows per partition and distinct counts
+    void SampleKeyColumns(ClientContext &context, const CassandraTableRef &table_ref,
+                          const vector<string> &partition_key, const vector<string> &clustering_key, int sample_rows,
+                          CassandraTableStatistics &result);
     
-    // Connection state tracking
-    mutable std::mutex connection_mutex;
-    mutable bool connection_valid;
+    struct CachedStatistics {
+        std::chrono::steady_clock::time_point loaded;
+        shared_ptr<const CassandraTableStatistics> statistics;
+    };
+    std::mutex statistics_mutex;
+    std::unordered_map<string, CachedStatistics> statistics_cache;
 };
 
 } // namespace cassandra
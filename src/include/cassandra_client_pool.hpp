@@ -0,0 +1,55 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "cassandra_utils.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Forward declaration
+namespace duckdb { namespace cassandra { class CassandraClient; } }
+
+namespace duckdb {
+namespace cassandra {
+
+// Process-wide registry of connected clients. Every scan, query and ATTACH of the same
+// cluster with the same credentials and TLS material leases the same client, so the
+// connect and topology discovery happen once per cluster instead of once per query.
+class CassandraClientPool {
+public:
+    static CassandraClientPool &Get();
+
+    // Lease the client for config, connecting on first use. The lease ends when the
+    // returned pointer is released; the client stays pooled until it has been idle a while.
+    shared_ptr<CassandraClient> Acquire(const CassandraConfig &config);
+
+    // Key identifying the cluster, credentials and TLS material of config
+    static string GetKey(const CassandraConfig &config);
+
+    // Number of clients currently pooled
+    idx_t Size();
+
+private:
+    CassandraClientPool() = default;
+
+    struct PoolEntry {
+        // Held while connecting, so concurrent leases of a new key connect only once
+        std::mutex connect_lock;
+        shared_ptr<CassandraClient> client;
+        // Last time the client was leased or seen in use
+        std::chrono::steady_clock::time_point last_used;
+    };
+
+    // Drop clients nobody holds that have been idle too long, then the least recently used
+    // idle clients while the pool is over capacity. Called with lock held; the dropped
+    // entries are handed back so they can be closed without it.
+    void EvictIdle(std::chrono::steady_clock::time_point now, vector<shared_ptr<PoolEntry>> &evicted);
+
+    std::mutex lock;
+    std::unordered_map<string, shared_ptr<PoolEntry>> entries;
+};
+
+} // namespace cassandra
+} // namespace duckdb
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/copy_function.hpp"
+
+namespace duckdb {
+namespace cassandra {
+
+// COPY ... TO 'keyspace.table' (FORMAT cassandra): writes the rows into an existing Cassandra
+// table through asynchronous prepared INSERTs. With CHECKPOINT the number of leading rows
+// acknowledged so far is kept in a local file, so rerunning a failed COPY skips them.
+class CassandraCopyFunction : public CopyFunction {
+public:
+    CassandraCopyFunction();
+};
+
+} // namespace cassandra
+} // namespace duckdb
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/vector_buffer.hpp"
+#include "cassandra_types.hpp"
+#include <cassandra.h>
+
+namespace duckdb {
+namespace cassandra {
+
+struct CassandraColumnDecoder;
+
+// Decodes one column of count rows of a result page into result[offset, offset + count)
+typedef void (*cassandra_decode_t)(const CassandraColumnDecoder &decoder, const CassRow* const* rows, idx_t count,
+                                   idx_t column, Vector &result, idx_t offset);
+// Decodes a single non-NULL value into result[index], returns false if it could not be read.
+// Used for collection elements and tuple or UDT fields.
+typedef bool (*cassandra_decode_value_t)(const CassandraColumnDecoder &decoder, const CassValue* value,
+                                         Vector &result, idx_t index);
+
+struct CassandraColumnDecoder {
+    cassandra_decode_t decode = nullptr;
+    cassandra_decode_value_t decode_value = nullptr;
+    // Decoders of the list element, the map key and value, or the tuple and UDT fields
+    vector<CassandraColumnDecoder> children;
+    // The decoded strings point into the result page, which has to be attached to the vector
+    bool references_page = false;
+};
+
+// Keeps a result page alive while string vectors reference its memory
+class CassandraPageBuffer : public VectorBuffer {
+public:
+    explicit CassandraPageBuffer(shared_ptr<const CassResult> page)
+        : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), page(std::move(page)) {
+    }
+
+private:
+    shared_ptr<const CassResult> page;
+};
+
+class CassandraDecoder {
+public:
+    // Pick the decoder for a Cassandra column type read into a DuckDB type. Called once at bind time
+    // so the scan does not dispatch on types per cell. With zero_copy, text and blob values
+    // reference the result page instead of being copied into the vector.
+    static CassandraColumnDecoder GetDecoder(const CassandraType &cass_type, const LogicalType &type, bool zero_copy);
+
+    // Text of a Cassandra value, used for columns exposed as VARCHAR. Collections, tuples and UDTs
+    // are rendered as CQL literals; values that cannot be read throw.
+    static string ValueToString(const CassValue* value);
+};
+
+} // namespace cassandra
+} // namespace duckdb
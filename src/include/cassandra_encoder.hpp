@@ -0,0 +1,65 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "cassandra_types.hpp"
+#include <cassandra.h>
+
+namespace duckdb {
+namespace cassandra {
+
+struct CassandraColumnEncoder;
+
+// Where an encoded value goes: a statement parameter, a collection element, or a tuple or UDT field
+struct CassandraEncodeTarget {
+    CassStatement* statement = nullptr;
+    CassCollection* collection = nullptr;
+    CassTuple* tuple = nullptr;
+    CassUserType* user_type = nullptr;
+    // Parameter or field index, unused for collections
+    size_t index = 0;
+};
+
+// Binds count rows of a column to parameter index of statements[0, count). NULLs are left
+// unset. Returns the first error of the driver.
+typedef CassError (*cassandra_encode_t)(const CassandraColumnEncoder &encoder, const RecursiveUnifiedVectorFormat &format,
+                                        idx_t count, CassStatement* const* statements, idx_t index);
+// Encodes the single non-NULL value at position idx of format's data into target.
+// Used for collection elements and tuple or UDT fields.
+typedef CassError (*cassandra_encode_value_t)(const CassandraColumnEncoder &encoder,
+                                              const RecursiveUnifiedVectorFormat &format, idx_t idx,
+                                              const CassandraEncodeTarget &target);
+
+// Serializes the single non-NULL value at position idx of format's data the way Cassandra stores it,
+// which is what the token of a partition key is computed from. Returns false if it cannot.
+typedef bool (*cassandra_serialize_t)(const CassandraColumnEncoder &encoder, const UnifiedVectorFormat &format,
+                                      idx_t idx, string &result);
+
+struct CassandraColumnEncoder {
+    cassandra_encode_t encode = nullptr;
+    cassandra_encode_value_t encode_value = nullptr;
+    // Set for the types rows can be grouped by the token of, nullptr for nested ones
+    cassandra_serialize_t serialize = nullptr;
+    // Encoders of the list element, the map key and value, or the tuple and UDT fields
+    vector<CassandraColumnEncoder> children;
+    // Type of the parameter, owned by the prepared statement
+    const CassDataType* data_type = nullptr;
+    CassValueType cass_type = CASS_VALUE_TYPE_UNKNOWN;
+    // Scale of DECIMAL columns
+    int32_t scale = 0;
+};
+
+class CassandraEncoder {
+public:
+    // Pick the encoder writing a DuckDB type into a parameter of the given type. Called once per
+    // statement so the writer does not dispatch on types per cell.
+    static CassandraColumnEncoder GetEncoder(const CassDataType* data_type, const LogicalType &type);
+
+    // Append the value at position idx of format to the serialized partition key the token is
+    // computed from. A component of a composite key is framed by its 16-bit length and a 0 byte.
+    // Returns false if encoder does not serialize its type or the value.
+    static bool SerializeKeyComponent(const CassandraColumnEncoder &encoder, const UnifiedVectorFormat &format,
+                                      idx_t idx, bool composite, string &key);
+};
+
+} // namespace cassandra
+} // namespace duckdb
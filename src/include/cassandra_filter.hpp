@@ -0,0 +1,23 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include <cassandra.h>
+
+namespace duckdb {
+namespace cassandra {
+
+// Translates DuckDB filters on key columns into a CQL WHERE clause
+class CassandraFilterPushdown {
+public:
+    // pushdown_complex_filter callback of cassandra_scan. Filters that are translated exactly
+    // are removed from the list, everything else stays to be evaluated by DuckDB.
+    static void PushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data,
+                                      vector<unique_ptr<Expression>> &filters);
+
+    // Bind the pushed down filter values starting at parameter index offset
+    static void BindParameters(CassStatement* statement, const vector<Value> &params, idx_t offset);
+};
+
+} // namespace cassandra
+} // namespace duckdb
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/function/function_set.hpp"
+#include "duckdb/function/table_function.hpp"
+
+namespace duckdb {
+namespace cassandra {
+
+// Functions exposing what the extension computes without asking the cluster: the partition key
+// serialization and token rows are grouped and routed by, the token ranges scans are split into
+// and the type mapping. They let the results be compared with Cassandra's own.
+
+// cassandra_token(key, ...): Murmur3 token of the partition key made of the given values, as
+// token(key, ...) returns it in CQL for a key of the CQL types cassandra_cql_type gives them
+class CassandraTokenFunction : public ScalarFunction {
+public:
+    CassandraTokenFunction();
+};
+
+// cassandra_serialize_key(key, ...): the serialized partition key cassandra_token hashes
+class CassandraSerializeKeyFunction : public ScalarFunction {
+public:
+    CassandraSerializeKeyFunction();
+};
+
+// cassandra_token_ranges(split_count, estimates := [...]): the ranges a scan with split_count
+// splits reads, cut by the given system.size_estimates rows
+class CassandraTokenRangesFunction : public TableFunction {
+public:
+    CassandraTokenRangesFunction();
+};
+
+// cassandra_type(cql_type [, decimal_scale]): DuckDB type a column of the CQL type is read as
+class CassandraTypeFunction : public ScalarFunctionSet {
+public:
+    CassandraTypeFunction();
+};
+
+// cassandra_cql_type(value): CQL type of the column CREATE TABLE creates for the type of value
+class CassandraCQLTypeFunction : public ScalarFunction {
+public:
+    CassandraCQLTypeFunction();
+};
+
+} // namespace cassandra
+} // namespace duckdb
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
+
+namespace duckdb {
+namespace cassandra {
+
+// Pushes LIMIT and "top N per partition" patterns into cassandra_scan, and gives DELETE and
+// UPDATE of Cassandra tables the primary key of the rows they modify
+class CassandraOptimizer {
+public:
+    static OptimizerExtension GetExtension();
+
+    // Runs before DuckDB's optimizers, while row_number() windows are still intact and before
+    // unused columns are removed from the scan
+    static void PreOptimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
+
+    // Runs after filter pushdown, when a LIMIT directly above the scan is final
+    static void Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
+};
+
+} // namespace cassandra
+} // namespace duckdb
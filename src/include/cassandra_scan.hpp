@@ -1,11 +1,13 @@
 #pragma once
 
 #include "duckdb.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "cassandra_decoder.hpp"
 #include "cassandra_utils.hpp"
 
 // Forward declaration
-namespace duckdb { namespace cassandra { class CassandraClient; } }
+namespace duckdb { namespace cassandra { class CassandraClient; struct CassandraTableStatistics; } }
 
 namespace duckdb {
 namespace cassandra {
@@ -13,8 +15,58 @@ namespace cassandra {
 struct CassandraScanBindData : public TableFunctionData {
     CassandraTableRef table_ref;
     CassandraConfig config;
+    // Pushed down WHERE clause with ? placeholders, and the values bound to them
     string filter_condition;
+    vector<Value> filter_params;
+    // Whether filter_condition restricts every primary key column by equality or IN, and the
+    // number of primary keys it then addresses
+    bool filter_fixes_primary_key = false;
+    idx_t filter_key_count = 0;
+    // CQL text of cassandra_query
+    string query;
+    // First page of cassandra_query, fetched at bind time for the column metadata and
+    // streamed by the first scan instead of executing the query again
+    mutable shared_ptr<const CassResult> first_page;
+    mutable mutex first_page_lock;
     shared_ptr<CassandraClient> reused_connection;
+    // Columns of the table (or query result) in DuckDB column order
+    vector<string> column_names;
+    vector<LogicalType> column_types;
+    vector<CassandraType> column_cass_types;
+    // Decoder of every column, chosen from its Cassandra and DuckDB type
+    vector<CassandraColumnDecoder> decoders;
+    // Let text and blob values point into the driver's result pages instead of copying them. Off
+    // by default: a page stays in memory for as long as any vector references one of its values.
+    bool zero_copy = false;
+    
+    // Partition key columns in key order, used to split the scan by token range
+    vector<string> partition_key;
+    // Clustering columns in key order, used for filter pushdown
+    vector<string> clustering_key;
+    // Whether each clustering column is stored in descending order
+    vector<bool> clustering_descending;
+    // CQL type of every key column
+    unordered_map<string, string> key_types;
+    // LIMIT and PER PARTITION LIMIT pushed down by the optimizer (0 = none)
+    idx_t limit = 0;
+    idx_t per_partition_limit = 0;
+    // Number of token ranges to split the scan into (0 = derive from size estimates)
+    idx_t split_count = 0;
+    
+    // Pick the decoder of every column from column_types and column_cass_types
+    void BindDecoders();
+    
+    // Hand out first_page once; later scans of the same bind execute the query themselves
+    shared_ptr<const CassResult> TakeFirstPage() const {
+        lock_guard<mutex> guard(first_page_lock);
+        return std::move(first_page);
+    }
+    
+    // Fill the key columns from the table schema
+    void LoadKeyColumns(const CassandraTableSchema &schema);
+    
+    // Cached size estimates and key statistics of the scanned table, nullptr for cassandra_query
+    shared_ptr<const CassandraTableStatistics> GetStatistics(ClientContext &context) const;
 };
 
 class CassandraScanFunction : public TableFunction {
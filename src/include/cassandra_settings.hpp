@@ -2,6 +2,7 @@
 
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
+#include "cassandra_utils.hpp"
 
 namespace duckdb {
 namespace cassandra {
@@ -32,6 +33,9 @@ struct CassandraSettings {
     static std::string GetCertFileHex(ClientContext &context);
     static std::string GetUserKeyHex(ClientContext &context);
     static std::string GetUserCertHex(ClientContext &context);
+    
+    // Copy the consistency, driver tuning, routing and write options set with SET cassandra_* into config
+    static void ApplyToConfig(ClientContext &context, CassandraConfig &config);
 };
 
 } // namespace cassandra
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace duckdb {
+namespace cassandra {
+
+// Bounds of the Murmur3Partitioner token ring
+static constexpr int64_t CASSANDRA_MIN_TOKEN = std::numeric_limits<int64_t>::min();
+static constexpr int64_t CASSANDRA_MAX_TOKEN = std::numeric_limits<int64_t>::max();
+
+// A slice of the token ring, matching token(pk) > start AND token(pk) <= end
+struct CassandraTokenRange {
+    int64_t start;
+    int64_t end;
+};
+
+// One row of system.size_estimates
+struct CassandraSizeEstimate {
+    int64_t range_start;
+    int64_t range_end;
+    int64_t partitions_count;
+    int64_t mean_partition_size;
+};
+
+// Table size extrapolated from the size estimates to the full ring
+struct CassandraTableSize {
+    double partitions = 0;
+    double bytes = 0;
+    bool has_estimates = false;
+};
+
+class CassandraTokenRanges {
+public:
+    // Extrapolate the size of the whole table from the ranges reported by one node
+    static CassandraTableSize EstimateTableSize(const vector<CassandraSizeEstimate> &estimates);
+
+    // Number of splits to read a table of the given size with the given thread count
+    static idx_t GetSplitCount(const CassandraTableSize &size, idx_t thread_count);
+
+    // Cut the ring into split_count ranges holding roughly the same amount of data
+    static vector<CassandraTokenRange> Split(const vector<CassandraSizeEstimate> &estimates, idx_t split_count);
+
+    // Murmur3Partitioner token of a serialized partition key
+    static int64_t GetToken(const uint8_t* data, idx_t size);
+
+    // Bytes whose token falls in range. Used as routing key of a token range statement, so
+    // the driver sends it to a replica of the range. Empty if none was found quickly.
+    static string GetRoutingKey(const CassandraTokenRange &range);
+};
+
+} // namespace cassandra
+} // namespace duckdb
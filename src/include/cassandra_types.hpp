@@ -8,6 +8,24 @@
 namespace duckdb {
 namespace cassandra {
 
+// A Cassandra type including the element types of collections and the fields of tuples and UDTs
+struct CassandraType {
+    CassValueType id = CASS_VALUE_TYPE_UNKNOWN;
+    // list/set: element type; map: key and value type; tuple and UDT: field types
+    vector<CassandraType> children;
+    // UDT field names, parallel to children
+    vector<std::string> field_names;
+    // UDT name or custom type class
+    std::string name;
+    
+    // Parse a type string from system_schema, e.g. "map<text, frozen<list<int>>>". UDTs are only
+    // known by name there, so they come back without fields.
+    static CassandraType Parse(const std::string &type_str);
+    
+    // Full type of a result column as described by the driver, including UDT fields
+    static CassandraType FromDataType(const CassDataType* data_type);
+};
+
 // Cassandra to DuckDB type mapping
 class CassandraTypeMapper {
 public:
@@ -17,27 +35,95 @@ public:
     // Convert Cassandra type string to DuckDB LogicalType
     static LogicalType CassandraTypeStringToDuckDBType(const std::string& type_str);
     
-    // Convert CassValue to DuckDB Value
+    // Type of a scanned column. Collections become LIST and MAP, tuples and UDTs STRUCT;
+    // collections and UDTs whose element types are unknown are read as VARCHAR. Decimals are
+    // DECIMAL(38, decimal_scale), or their exact text when decimal_scale is negative.
+    static LogicalType ToDuckDBType(const CassandraType &type, int decimal_scale = -1);
+    
+    // Convert CassValue to a DuckDB Value of target_type, as given by ToDuckDBType for its type
     static Value CassValueToDuckDBValue(const CassValue* value, const LogicalType& target_type);
     
     // Get type name for debugging
     static std::string GetCassandraTypeName(CassValueType cass_type);
     
+    // CQL type of a new column holding DuckDB values of type. Collections nested in another
+    // type, and those of key columns, have to be frozen. STRUCTs become tuples, so their fields
+    // have to be unnamed or named _1, _2, ...
+    static std::string ToCQLType(const LogicalType &type, bool frozen = false);
+    
+    // Convert between the driver's UUID fields and DuckDB's UUID hugeint without a string round trip.
+    // time_and_version holds time_low in bits 0-31, time_mid in 32-47 and time_hi in 48-63, while
+    // DuckDB stores the 16 bytes big-endian with the top bit flipped, so byte order sorting is kept.
+    static hugeint_t UUIDToHugeint(const CassUuid &uuid) {
+        uint64_t time_and_version = uuid.time_and_version;
+        uint64_t upper = ((time_and_version & 0xFFFFFFFFULL) << 32) | (((time_and_version >> 32) & 0xFFFFULL) << 16) |
+                         (time_and_version >> 48);
+        hugeint_t result;
+        result.upper = static_cast<int64_t>(upper ^ (uint64_t(1) << 63));
+        result.lower = uuid.clock_seq_and_node;
+        return result;
+    }
+    
+    // Decode a varint (big-endian two's complement, as produced by Java's BigInteger).
+    // Returns false if it does not fit 128 bits.
+    static bool VarintToHugeint(const cass_byte_t* bytes, size_t size, hugeint_t &result) {
+        if (size > sizeof(hugeint_t)) {
+            return false;
+        }
+        uint64_t fill = size > 0 && (bytes[0] & 0x80) ? ~uint64_t(0) : 0;
+        uint64_t upper = fill;
+        uint64_t lower = fill;
+        for (size_t i = 0; i < size; i++) {
+            upper = (upper << 8) | (lower >> 56);
+            lower = (lower << 8) | bytes[i];
+        }
+        result.upper = static_cast<int64_t>(upper);
+        result.lower = lower;
+        return true;
+    }
+    
+    // Encode value as the shortest varint, returns the number of bytes written to bytes
+    static size_t HugeintToVarint(const hugeint_t &value, cass_byte_t bytes[16]) {
+        uint64_t upper = static_cast<uint64_t>(value.upper);
+        for (size_t i = 0; i < 8; i++) {
+            bytes[i] = static_cast<cass_byte_t>(upper >> (56 - 8 * i));
+            bytes[8 + i] = static_cast<cass_byte_t>(value.lower >> (56 - 8 * i));
+        }
+        // Leading bytes that only repeat the sign bit of the next one are dropped
+        size_t start = 0;
+        while (start < 15 && ((bytes[start] == 0x00 && !(bytes[start + 1] & 0x80)) ||
+                              (bytes[start] == 0xFF && (bytes[start + 1] & 0x80)))) {
+            start++;
+        }
+        for (size_t i = start; i < 16; i++) {
+            bytes[i - start] = bytes[i];
+        }
+        return 16 - start;
+    }
+    
+    static CassUuid HugeintToUUID(const hugeint_t &value) {
+        uint64_t upper = static_cast<uint64_t>(value.upper) ^ (uint64_t(1) << 63);
+        CassUuid uuid;
+        uuid.time_and_version = (upper >> 32) | (((upper >> 16) & 0xFFFFULL) << 32) | ((upper & 0xFFFFULL) << 48);
+        uuid.clock_seq_and_node = value.lower;
+        return uuid;
+    }
+    
 private:
+    friend struct CassandraType;
     static const std::unordered_map<CassValueType, LogicalType> type_map_;
-    static const std::unordered_map<std::string, LogicalType> type_string_map_;
+    static const std::unordered_map<std::string, CassValueType> type_string_map_;
 };
 
-// Column information from Cassandra schema
-struct CassandraColumnInfo {
-    std::string column_name;
-    std::string type;
-    std::string kind; // partition_key, clustering, regular, static
-    int position;
-    
-    LogicalType GetDuckDBType() const {
-        return CassandraTypeMapper::CassandraTypeStringToDuckDBType(type);
-    }
+// Columns and primary key of a table, from the driver's schema metadata
+struct CassandraTableSchema {
+    // Columns in SELECT * order: partition key, clustering key, then the rest by name
+    vector<std::string> column_names;
+    vector<CassandraType> column_types;
+    vector<std::string> partition_key;
+    vector<std::string> clustering_key;
+    // Whether each clustering column is stored in descending order
+    vector<bool> clustering_descending;
 };
 
 } // namespace cassandra
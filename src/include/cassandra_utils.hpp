@@ -15,6 +15,37 @@ struct CassandraConfig {
     std::string password;
     std::string keyspace;
     std::string consistency = "ONE";
+    // Consistency of the Paxos phase of conditional writes, empty for the driver default
+    std::string serial_consistency;
+    
+    // Driver tuning; 0 keeps the driver default unless noted otherwise
+    int io_threads = 0;
+    int core_connections_per_host = 0;
+    int queue_size_io = 0;           // Requests queued per IO thread
+    int request_timeout_ms = 0;
+    int connect_timeout_ms = 0;
+    bool tcp_nodelay = true;
+    int tcp_keepalive_secs = 0;      // 0 = keepalive off
+    int64_t coalesce_delay_us = -1;  // -1 = driver default, 0 = no coalescing
+    int page_size = 5000;            // Rows per page of every statement
+    
+    // Routing: only coordinators in local_dc are used (astra_dc for Astra when empty), and
+    // with token_aware requests go to a replica of the data they read
+    std::string local_dc;
+    bool token_aware = true;
+    // Writes: requests in flight over all threads of one statement, rows of the same partition
+    // sent as one UNLOGGED batch, and retries of a request that timed out or found no replica
+    int write_concurrency = 256;
+    int write_batch_size = 16;
+    int write_retries = 3;
+    int64_t write_rate = 0;          // Rows written per second over all threads (0 = unlimited)
+    // Scale of the DECIMAL decimal columns are read as. Every Cassandra decimal carries its own
+    // scale, so by default (-1) they are read as their exact text.
+    int decimal_scale = -1;
+    // Seconds table size estimates and key statistics are cached for (0 = always refresh)
+    int statistics_ttl = 300;
+    // Rows sampled to estimate rows per partition and key distinct counts (0 = no sampling)
+    int statistics_sample_rows = 1000;
     
     // SSL/TLS Configuration
     bool use_ssl = false;
@@ -48,6 +79,8 @@ struct CassandraConfig {
     std::string astra_client_key_b64;  // Base64 encoded private key
     
     static CassandraConfig FromConnectionString(const std::string& connection_string);
+    // Parse connection_string on top of base, e.g. defaults from SET cassandra_* options
+    static CassandraConfig FromConnectionString(const std::string& connection_string, const CassandraConfig &base);
     
     // Helper methods for SSL
     std::string DecodeHexToString(const std::string& hex) const;
@@ -68,6 +101,9 @@ struct CassandraTableRef {
     }
 };
 
+// Quote a column or table name for use in CQL
+std::string QuoteCQLIdentifier(const std::string& identifier);
+
 // Forward declarations for storage extension functions
 unique_ptr<Catalog> CassandraAttachCatalog(optional_ptr<StorageExtensionInfo> storage_info,
                                            ClientContext &context, AttachedDatabase &db, const string &name,
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "cassandra_encoder.hpp"
+#include "cassandra_utils.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <cassandra.h>
+
+// Forward declaration
+namespace duckdb { namespace cassandra { class CassandraClient; } }
+
+namespace duckdb {
+namespace cassandra {
+
+// Statement a writer sends for every row
+enum class CassandraWriteType : uint8_t {
+    // INSERT of the columns, NULLs are left unset
+    INSERT_ROWS,
+    // UPDATE of the non-key columns by primary key, NULLs clear the column
+    UPDATE_ROWS,
+    // DELETE by primary key, the columns are just the primary key
+    DELETE_ROWS
+};
+
+// Table being written and the state shared by every thread writing into it
+class CassandraWriteTarget {
+public:
+    // Prepare the statement writing column_names into table_ref. Every primary key column has to
+    // be among them; rows are grouped into batches by the partition key columns.
+    CassandraWriteTarget(shared_ptr<CassandraClient> client, const CassandraTableRef &table_ref,
+                         CassandraWriteType type, vector<string> column_names, vector<LogicalType> column_types,
+                         const vector<string> &partition_key_names, const vector<string> &clustering_key_names,
+                         const CassandraConfig &options);
+
+    shared_ptr<CassandraClient> client;
+    CassandraTableRef table_ref;
+    CassandraWriteType type;
+    vector<string> column_names;
+    vector<LogicalType> column_types;
+    CassandraConfig options;
+
+    shared_ptr<const CassPrepared> prepared;
+    vector<CassandraColumnEncoder> encoders;
+    // Statement parameter every column is bound to
+    vector<idx_t> parameters;
+    // Positions of the partition key and of every primary key column in column_names
+    vector<idx_t> partition_key;
+    vector<idx_t> primary_key;
+
+    // Requests in flight over all writers, kept at options.write_concurrency
+    std::atomic<idx_t> in_flight;
+    // Wait until rows more rows may be sent without exceeding options.write_rate
+    void Throttle(idx_t rows);
+    // Totals over all writers
+    std::atomic<idx_t> rows_written;
+    std::atomic<idx_t> requests;
+    std::atomic<idx_t> retries;
+    std::atomic<idx_t> timeouts;
+
+private:
+    // Earliest time the next request may be sent when write_rate is set
+    std::mutex rate_lock;
+    std::chrono::steady_clock::time_point next_send;
+};
+
+// Writes chunks into a target from one thread. Every row becomes a statement bound from the
+// prepared statement column by column; rows of the same partition are sent together as small
+// UNLOGGED batches routed by their token, and requests stay in flight asynchronously while the
+// next chunk is bound.
+class CassandraWriter {
+public:
+    explicit CassandraWriter(shared_ptr<CassandraWriteTarget> target);
+    ~CassandraWriter();
+
+    // Send the rows of chunk, whose columns are those of the target. Blocks while the target
+    // has write_concurrency requests in flight, or while sending would exceed write_rate; a
+    // request that fails for good throws.
+    void Append(DataChunk &chunk);
+
+    // Wait until every request sent so far has been acknowledged
+    void Flush();
+
+    CassandraWriteTarget &GetTarget() {
+        return *target;
+    }
+
+private:
+    struct PendingRequest {
+        // Exactly one of statement and batch is set
+        CassStatement* statement = nullptr;
+        CassBatch* batch = nullptr;
+        CassFuture* future = nullptr;
+        // Session future was sent through, held until it has completed
+        shared_ptr<CassSession> session;
+        idx_t rows = 0;
+        int attempts = 0;
+        // When a failed request is sent again; it is not in flight meanwhile
+        std::chrono::steady_clock::time_point retry_at;
+    };
+
+    // Serialized partition key and token of every row of chunk. Returns false if the key has a
+    // type that is not serialized here.
+    bool ComputeTokens(DataChunk &chunk);
+    // Send request once fewer than write_concurrency requests are in flight
+    void Send(PendingRequest request);
+    void Execute(PendingRequest &request);
+    // Wait for the oldest request. Once it is waiting to be retried, resend it when it is due and
+    // wait for younger requests until then.
+    void WaitOldest();
+    // Take the result of the completed request at index. A transient error leaves it in place to
+    // be retried, any other error throws.
+    void Complete(idx_t index);
+    void FreeRequest(PendingRequest &request);
+    void FreeStatements();
+
+    shared_ptr<CassandraWriteTarget> target;
+    std::deque<PendingRequest> pending;
+    // Statements of the chunk being bound, not yet handed to a request
+    vector<CassStatement*> statements;
+    // Partition key and token of every row of the chunk being bound
+    vector<string> keys;
+    vector<int64_t> tokens;
+};
+
+} // namespace cassandra
+} // namespace duckdb
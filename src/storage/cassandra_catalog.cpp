@@ -1,8 +1,15 @@
 #include "cassandra_catalog.hpp"
 #include "cassandra_schema_entry.hpp"
+#include "cassandra_insert.hpp"
+#include "cassandra_modify.hpp"
+#include "cassandra_transaction.hpp"
 #include "../include/cassandra_client.hpp"
+#include "../include/cassandra_client_pool.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/drop_info.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/planner/operator/logical_create_table.hpp"
+#include "duckdb/planner/operator/logical_insert.hpp"
 #include "duckdb/storage/database_size.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 
@@ -13,7 +20,7 @@ CassandraCatalog::CassandraCatalog(AttachedDatabase &db, const string &name, con
                                    AccessMode access_mode, const CassandraConfig &config)
     : Catalog(db), config(config) {
     
-    client = make_shared_ptr<CassandraClient>(config);
+    client = CassandraClientPool::Get().Acquire(config);
 }
 
 CassandraCatalog::~CassandraCatalog() = default;
@@ -45,9 +52,49 @@ optional_ptr<CatalogEntry> CassandraCatalog::CreateSchema(CatalogTransaction tra
     }
 
     client->CreateKeyspace(info, keyspace_ref);
+    ClearCache();
     return nullptr;
 }
 
+void CassandraCatalog::CheckSchemaVersion() {
+    auto version = client->GetSchemaVersion();
+    if (version == schema_version) {
+        return;
+    }
+    // Transactions that looked up the dropped entries keep them alive until they end
+    schemas.clear();
+    schemas_loaded = false;
+    schema_version = version;
+}
+
+void CassandraCatalog::ClearCache() {
+    std::lock_guard<std::mutex> guard(entry_lock);
+    schemas.clear();
+    schemas_loaded = false;
+}
+
+shared_ptr<CassandraSchemaEntry> CassandraCatalog::GetSchemaEntry(const string &keyspace_name) {
+    auto entry = schemas.find(keyspace_name);
+    if (entry != schemas.end()) {
+        return entry->second;
+    }
+    if (schemas_loaded) {
+        // Every keyspace is already cached
+        return nullptr;
+    }
+    string name;
+    vector<string> table_names;
+    if (!client->GetKeyspaceMetadata(keyspace_name, name, table_names)) {
+        return nullptr;
+    }
+    CreateSchemaInfo schema_info;
+    schema_info.schema = name;
+    auto schema_entry = make_shared_ptr<CassandraSchemaEntry>(*this, schema_info, CassandraKeyspaceRef{name});
+    schema_entry->SetTableNames(std::move(table_names));
+    schemas[name] = schema_entry;
+    return schema_entry;
+}
+
 optional_ptr<SchemaCatalogEntry> CassandraCatalog::LookupSchema(CatalogTransaction transaction,
                                                                 const EntryLookupInfo &schema_lookup,
                                                                 OnEntryNotFound if_not_found) {
@@ -58,19 +105,46 @@ optional_ptr<SchemaCatalogEntry> CassandraCatalog::LookupSchema(CatalogTransacti
         schema_name = config.keyspace.empty() ? "sfpla" : config.keyspace;
     }
     
-    auto keyspace_ref = client->GetKeyspace(schema_name);
-    CreateSchemaInfo schema_info;
-    schema_info.schema = schema_name;
-    return make_uniq<CassandraSchemaEntry>(*this, schema_info, keyspace_ref).release();
+    shared_ptr<CassandraSchemaEntry> schema_entry;
+    {
+        std::lock_guard<std::mutex> guard(entry_lock);
+        CheckSchemaVersion();
+        schema_entry = GetSchemaEntry(schema_name);
+    }
+    if (!schema_entry) {
+        if (if_not_found == OnEntryNotFound::RETURN_NULL) {
+            return nullptr;
+        }
+        throw CatalogException("Keyspace \"%s\" does not exist", schema_name);
+    }
+    auto result = schema_entry.get();
+    if (transaction.context) {
+        // The entry and its tables stay valid for the transaction binding against them
+        CassandraTransaction::Get(*transaction.context, *this).KeepAlive(std::move(schema_entry));
+    }
+    return result;
 }
 
 void CassandraCatalog::ScanSchemas(ClientContext &context, std::function<void(SchemaCatalogEntry &)> callback) {
-    auto keyspaces = client->GetKeyspaces();
-    for (const auto& ks : keyspaces) {
-        CreateSchemaInfo schema_info;
-        schema_info.schema = ks.keyspace_name;
-        auto schema_entry = make_uniq<CassandraSchemaEntry>(*this, schema_info, ks);
-        callback(*schema_entry);
+    vector<shared_ptr<CassandraSchemaEntry>> entries;
+    {
+        std::lock_guard<std::mutex> guard(entry_lock);
+        CheckSchemaVersion();
+        if (!schemas_loaded) {
+            for (auto &keyspace_name : client->GetKeyspaceNames()) {
+                GetSchemaEntry(keyspace_name);
+            }
+            schemas_loaded = true;
+        }
+        for (auto &entry : schemas) {
+            entries.push_back(entry.second);
+        }
+    }
+    auto &transaction = CassandraTransaction::Get(context, *this);
+    for (auto &entry : entries) {
+        auto &schema_entry = *entry;
+        transaction.KeepAlive(std::move(entry));
+        callback(schema_entry);
     }
 }
 
@@ -83,34 +157,48 @@ void CassandraCatalog::DropSchema(ClientContext &context, DropInfo &info) {
     }
 
     client->DropKeyspace(info);
+    ClearCache();
 }
 
 PhysicalOperator &CassandraCatalog::PlanCreateTableAs(ClientContext &context,
                                                        PhysicalPlanGenerator &planner,
                                                        LogicalCreateTable &op,
                                                        PhysicalOperator &plan) {
-    throw NotImplementedException("CREATE TABLE AS not supported for Cassandra");
+    // The insert creates the table once the query starts running, then streams the rows into it
+    auto &insert = planner.Make<CassandraInsert>(op, op.schema, std::move(op.info));
+    insert.children.push_back(plan);
+    return insert;
 }
 
 PhysicalOperator &CassandraCatalog::PlanInsert(ClientContext &context,
                                                 PhysicalPlanGenerator &planner,
                                                 LogicalInsert &op,
                                                 optional_ptr<PhysicalOperator> plan) {
-    throw NotImplementedException("INSERT not yet supported for Cassandra");
+    if (op.return_chunk) {
+        throw BinderException("RETURNING clause not supported for INSERT into Cassandra");
+    }
+    if (op.action_type != OnConflictAction::THROW) {
+        // Every INSERT already replaces the row with the same primary key
+        throw BinderException("ON CONFLICT clause not supported for INSERT into Cassandra");
+    }
+    D_ASSERT(plan);
+    auto &insert = planner.Make<CassandraInsert>(op, op.table.Cast<CassandraTableEntry>(), op.column_index_map);
+    insert.children.push_back(*plan);
+    return insert;
 }
 
 PhysicalOperator &CassandraCatalog::PlanDelete(ClientContext &context,
                                                 PhysicalPlanGenerator &planner,
                                                 LogicalDelete &op,
                                                 PhysicalOperator &plan) {
-    throw NotImplementedException("DELETE not supported for Cassandra");
+    return CassandraModify::PlanDelete(context, planner, op, plan);
 }
 
 PhysicalOperator &CassandraCatalog::PlanUpdate(ClientContext &context,
                                                 PhysicalPlanGenerator &planner,
                                                 LogicalUpdate &op,
                                                 PhysicalOperator &plan) {
-    throw NotImplementedException("UPDATE not supported for Cassandra");
+    return CassandraModify::PlanUpdate(context, planner, op, plan);
 }
 
 unique_ptr<LogicalOperator> CassandraCatalog::BindCreateIndex(Binder &binder,
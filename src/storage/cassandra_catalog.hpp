@@ -4,6 +4,9 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 #include "../include/cassandra_utils.hpp"
+#include "cassandra_schema_entry.hpp"
+
+#include <mutex>
 
 // Forward declaration
 namespace duckdb { namespace cassandra { class CassandraClient; } }
@@ -64,8 +67,22 @@ public:
     // Get shared client connection for table operations
     shared_ptr<CassandraClient> GetSharedClient() const;
     
+    // Drop the cached schema and table entries, they are loaded again on next lookup
+    void ClearCache();
+    
 private:
     shared_ptr<class CassandraClient> client;
+    
+    // Clear the cache when the driver reports a schema change. Called with entry_lock held.
+    void CheckSchemaVersion();
+    shared_ptr<CassandraSchemaEntry> GetSchemaEntry(const string &keyspace_name);
+    
+    std::mutex entry_lock;
+    // Entries dropped from the cache may still be referenced by plans being bound, so every
+    // transaction holds on to the entries it looked up
+    case_insensitive_map_t<shared_ptr<CassandraSchemaEntry>> schemas;
+    bool schemas_loaded = false;
+    uint32_t schema_version = 0;
 };
 
 } // namespace cassandra
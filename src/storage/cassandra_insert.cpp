@@ -0,0 +1,148 @@
+#include "cassandra_insert.hpp"
+#include "cassandra_catalog.hpp"
+#include "cassandra_transaction.hpp"
+#include "../include/cassandra_client.hpp"
+#include "../include/cassandra_writer.hpp"
+
+namespace duckdb {
+namespace cassandra {
+
+CassandraInsert::CassandraInsert(PhysicalPlan &physical_plan, LogicalOperator &op, CassandraTableEntry &table,
+                                 physical_index_vector_t<idx_t> column_index_map)
+    : PhysicalOperator(physical_plan, PhysicalOperatorType::EXTENSION, op.types, 1), table(&table) {
+    // Columns left out are not written at all, rather than overwritten with NULL
+    for (auto &column : table.GetColumns().Physical()) {
+        auto source = column.Physical().index;
+        if (!column_index_map.empty()) {
+            source = column_index_map[column.Physical()];
+            if (source == DConstants::INVALID_INDEX) {
+                continue;
+            }
+        }
+        column_names.push_back(column.Name());
+        column_types.push_back(column.Type());
+        source_columns.push_back(source);
+    }
+}
+
+CassandraInsert::CassandraInsert(PhysicalPlan &physical_plan, LogicalOperator &op, SchemaCatalogEntry &schema,
+                                 unique_ptr<BoundCreateTableInfo> info_p)
+    : PhysicalOperator(physical_plan, PhysicalOperatorType::EXTENSION, op.types, 1), schema(&schema),
+      info(std::move(info_p)) {
+    // The query produces every column of the new table in order
+    for (auto &column : info->Base().columns.Physical()) {
+        column_names.push_back(column.Name());
+        column_types.push_back(column.Type());
+        source_columns.push_back(column.Physical().index);
+    }
+}
+
+class CassandraInsertGlobalState : public GlobalSinkState {
+public:
+    // nullptr when CREATE TABLE IF NOT EXISTS found the table, then nothing is written
+    shared_ptr<CassandraWriteTarget> target;
+    // Set in an explicit transaction, which sends the rows when it commits
+    optional_ptr<CassandraTransaction> transaction;
+    std::atomic<idx_t> rows_buffered {0};
+};
+
+class CassandraInsertLocalState : public LocalSinkState {
+public:
+    explicit CassandraInsertLocalState(shared_ptr<CassandraWriteTarget> target) : writer(std::move(target)) {
+    }
+
+    CassandraWriter writer;
+    // Rows held for the transaction instead of being written
+    unique_ptr<ColumnDataCollection> buffer;
+    // The inserted columns in the order of the prepared INSERT
+    DataChunk insert_chunk;
+};
+
+unique_ptr<GlobalSinkState> CassandraInsert::GetGlobalSinkState(ClientContext &context) const {
+    auto result = make_uniq<CassandraInsertGlobalState>();
+    auto insert_table = table;
+    if (!insert_table) {
+        // Created once here, before any thread starts writing into it
+        auto entry = schema->CreateTable(schema->catalog.GetCatalogTransaction(context), *info);
+        if (!entry) {
+            return std::move(result);
+        }
+        insert_table = &entry->Cast<CassandraTableEntry>();
+    }
+    auto &catalog = insert_table->catalog.Cast<CassandraCatalog>();
+    result->target = make_shared_ptr<CassandraWriteTarget>(
+        catalog.GetSharedClient(), insert_table->GetTableRef(), CassandraWriteType::INSERT_ROWS, column_names,
+        column_types, insert_table->table_schema.partition_key, insert_table->table_schema.clustering_key,
+        catalog.config);
+    if (CassandraTransaction::BufferWrites(context)) {
+        result->transaction = CassandraTransaction::Get(context, catalog);
+    }
+    return std::move(result);
+}
+
+unique_ptr<LocalSinkState> CassandraInsert::GetLocalSinkState(ExecutionContext &context) const {
+    auto &gstate = sink_state->Cast<CassandraInsertGlobalState>();
+    auto result = make_uniq<CassandraInsertLocalState>(gstate.target);
+    result->insert_chunk.InitializeEmpty(column_types);
+    if (gstate.transaction) {
+        result->buffer = make_uniq<ColumnDataCollection>(context.client, column_types);
+    }
+    return std::move(result);
+}
+
+SinkResultType CassandraInsert::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+    auto &gstate = sink_state->Cast<CassandraInsertGlobalState>();
+    if (!gstate.target) {
+        return SinkResultType::FINISHED;
+    }
+    auto &lstate = input.local_state.Cast<CassandraInsertLocalState>();
+    for (idx_t i = 0; i < source_columns.size(); i++) {
+        lstate.insert_chunk.data[i].Reference(chunk.data[source_columns[i]]);
+    }
+    lstate.insert_chunk.SetCardinality(chunk);
+    if (lstate.buffer) {
+        lstate.buffer->Append(lstate.insert_chunk);
+    } else {
+        lstate.writer.Append(lstate.insert_chunk);
+    }
+    return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType CassandraInsert::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+    auto &gstate = sink_state->Cast<CassandraInsertGlobalState>();
+    auto &lstate = input.local_state.Cast<CassandraInsertLocalState>();
+    if (lstate.buffer) {
+        gstate.rows_buffered += lstate.buffer->Count();
+        gstate.transaction->BufferRows(gstate.target, std::move(lstate.buffer));
+    } else {
+        lstate.writer.Flush();
+    }
+    return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType CassandraInsert::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                           OperatorSinkFinalizeInput &input) const {
+    return SinkFinalizeType::READY;
+}
+
+SourceResultType CassandraInsert::GetData(ExecutionContext &context, DataChunk &chunk,
+                                          OperatorSourceInput &input) const {
+    auto &gstate = sink_state->Cast<CassandraInsertGlobalState>();
+    auto rows_written = gstate.target ? gstate.target->rows_written + gstate.rows_buffered : 0;
+    chunk.SetCardinality(1);
+    chunk.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(rows_written)));
+    return SourceResultType::FINISHED;
+}
+
+string CassandraInsert::GetName() const {
+    return "CASSANDRA_INSERT";
+}
+
+InsertionOrderPreservingMap<string> CassandraInsert::ParamsToString() const {
+    InsertionOrderPreservingMap<string> result;
+    result["Table Name"] = table ? table->GetTableRef().GetQualifiedName() : info->Base().table;
+    return result;
+}
+
+} // namespace cassandra
+} // namespace duckdb
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
+#include "cassandra_table_entry.hpp"
+
+namespace duckdb {
+namespace cassandra {
+
+// INSERT into an attached Cassandra table. Every thread sinks its chunks through its own
+// CassandraWriter; the count of written rows is returned once all of them are acknowledged.
+class CassandraInsert : public PhysicalOperator {
+public:
+    // column_index_map maps each table column to its column in the inserted chunks, or to
+    // INVALID_INDEX for columns the INSERT leaves out; empty when every column is inserted
+    CassandraInsert(PhysicalPlan &physical_plan, LogicalOperator &op, CassandraTableEntry &table,
+                    physical_index_vector_t<idx_t> column_index_map);
+    // CREATE TABLE AS: the table is created in schema before the first row is written
+    CassandraInsert(PhysicalPlan &physical_plan, LogicalOperator &op, SchemaCatalogEntry &schema,
+                    unique_ptr<BoundCreateTableInfo> info);
+
+    // Table inserted into, nullptr for CREATE TABLE AS
+    optional_ptr<CassandraTableEntry> table;
+    // Schema and table to create for CREATE TABLE AS
+    optional_ptr<SchemaCatalogEntry> schema;
+    unique_ptr<BoundCreateTableInfo> info;
+    // Written columns and where they come from in the inserted chunks
+    vector<string> column_names;
+    vector<LogicalType> column_types;
+    vector<idx_t> source_columns;
+
+public:
+    // Source interface
+    SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+    bool IsSource() const override {
+        return true;
+    }
+
+public:
+    // Sink interface
+    unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+    unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+    SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+    SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+    SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                              OperatorSinkFinalizeInput &input) const override;
+
+    bool IsSink() const override {
+        return true;
+    }
+
+    bool ParallelSink() const override {
+        return true;
+    }
+
+    // Cassandra orders rows by their key, the order they arrive in does not matter
+    bool SinkOrderDependent() const override {
+        return false;
+    }
+
+    string GetName() const override;
+    InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+} // namespace cassandra
+} // namespace duckdb
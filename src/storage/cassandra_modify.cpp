@@ -0,0 +1,341 @@
+#include "cassandra_modify.hpp"
+#include "cassandra_catalog.hpp"
+#include "cassandra_transaction.hpp"
+#include "../include/cassandra_client.hpp"
+#include "../include/cassandra_filter.hpp"
+#include "../include/cassandra_scan.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+namespace cassandra {
+
+namespace {
+
+// Scan of table below plan, through projections only, when it evaluates every filter of the
+// statement itself. nullptr when DuckDB still filters or limits the scanned rows.
+const CassandraScanBindData* GetPushedScan(PhysicalOperator &plan, CassandraTableEntry &table) {
+    reference<PhysicalOperator> op(plan);
+    while (op.get().type == PhysicalOperatorType::PROJECTION) {
+        op = op.get().children[0];
+    }
+    if (op.get().type != PhysicalOperatorType::TABLE_SCAN) {
+        return nullptr;
+    }
+    auto &scan = op.get().Cast<PhysicalTableScan>();
+    if (scan.function.name != "cassandra_scan" || !scan.bind_data ||
+        (scan.table_filters && !scan.table_filters->filters.empty())) {
+        return nullptr;
+    }
+    auto &bind_data = scan.bind_data->Cast<CassandraScanBindData>();
+    if (bind_data.table_ref.GetQualifiedName() != table.GetTableRef().GetQualifiedName() || bind_data.limit != 0 ||
+        bind_data.per_partition_limit != 0) {
+        return nullptr;
+    }
+    return &bind_data;
+}
+
+// Primary key columns of table, partition key first, as appended to the statement by the optimizer
+vector<string> GetPrimaryKey(CassandraTableEntry &table) {
+    auto result = table.table_schema.partition_key;
+    auto &clustering_key = table.table_schema.clustering_key;
+    result.insert(result.end(), clustering_key.begin(), clustering_key.end());
+    return result;
+}
+
+// Copy the key expressions the optimizer appended after the first offset expressions
+void CopyKeyExpressions(const vector<unique_ptr<Expression>> &expressions, idx_t offset, idx_t key_count,
+                        CassandraTableEntry &table, const char* statement, vector<unique_ptr<Expression>> &result) {
+    if (key_count == 0 || expressions.size() != offset + key_count) {
+        throw NotImplementedException("%s of Cassandra table %s needs a scan of the table's primary key", statement,
+                                      table.GetTableRef().GetQualifiedName());
+    }
+    for (idx_t i = offset; i < expressions.size(); i++) {
+        result.push_back(expressions[i]->Copy());
+    }
+}
+
+} // namespace
+
+CassandraModify::CassandraModify(PhysicalPlan &physical_plan, LogicalOperator &op, CassandraTableEntry &table,
+                                 CassandraWriteType type, vector<string> column_names_p,
+                                 vector<unique_ptr<Expression>> expressions_p)
+    : PhysicalOperator(physical_plan, PhysicalOperatorType::EXTENSION, op.types, 1), table(table), type(type),
+      column_names(std::move(column_names_p)), expressions(std::move(expressions_p)) {
+    for (auto &expr : expressions) {
+        column_types.push_back(expr->return_type);
+    }
+}
+
+PhysicalOperator &CassandraModify::PlanDelete(ClientContext &context, PhysicalPlanGenerator &planner,
+                                              LogicalDelete &op, PhysicalOperator &plan) {
+    if (op.return_chunk) {
+        throw BinderException("RETURNING clause not supported for DELETE from Cassandra");
+    }
+    auto &table = op.table.Cast<CassandraTableEntry>();
+    auto table_name = table.GetTableRef().GetQualifiedName();
+
+    // A partition key with a clustering range becomes a single range tombstone, whose row count is
+    // unknown. Whole keys are deleted row by row after a point read each, so only rows that exist
+    // are deleted and counted; a DELETE without WHERE clause the same way, it is no TRUNCATE.
+    auto bind_data = GetPushedScan(plan, table);
+    if (bind_data && !bind_data->filter_condition.empty() && !bind_data->filter_fixes_primary_key) {
+        auto query = "DELETE FROM " + table_name + " WHERE " + bind_data->filter_condition;
+        return planner.Make<CassandraModifyByKey>(op, table, CassandraWriteType::DELETE_ROWS, query, vector<string>(),
+                                                  vector<Value>(), bind_data->filter_params, optional_idx());
+    }
+
+    // The first expression is DuckDB's row id, which Cassandra rows do not have
+    auto column_names = GetPrimaryKey(table);
+    vector<unique_ptr<Expression>> expressions;
+    CopyKeyExpressions(op.expressions, 1, column_names.size(), table, "DELETE", expressions);
+    auto &modify = planner.Make<CassandraModify>(op, table, CassandraWriteType::DELETE_ROWS, std::move(column_names),
+                                                 std::move(expressions));
+    modify.children.push_back(plan);
+    return modify;
+}
+
+PhysicalOperator &CassandraModify::PlanUpdate(ClientContext &context, PhysicalPlanGenerator &planner,
+                                              LogicalUpdate &op, PhysicalOperator &plan) {
+    if (op.return_chunk) {
+        throw BinderException("RETURNING clause not supported for UPDATE of Cassandra");
+    }
+    auto &table = op.table.Cast<CassandraTableEntry>();
+    auto table_name = table.GetTableRef().GetQualifiedName();
+    auto primary_key = GetPrimaryKey(table);
+
+    vector<string> column_names;
+    vector<LogicalType> column_types;
+    for (auto &index : op.columns) {
+        auto &column = table.GetColumns().GetColumn(index);
+        if (std::find(primary_key.begin(), primary_key.end(), column.Name()) != primary_key.end()) {
+            throw BinderException("Cannot update primary key column \"%s\" of Cassandra table %s", column.Name(),
+                                  table_name);
+        }
+        column_names.push_back(column.Name());
+        column_types.push_back(column.Type());
+    }
+
+    // With the whole primary key fixed by the WHERE clause and constant SET values, a single CQL
+    // UPDATE does it. Like every CQL UPDATE it is an upsert: keys without a row get one.
+    auto bind_data = GetPushedScan(plan, table);
+    if (bind_data && bind_data->filter_fixes_primary_key && !bind_data->filter_condition.empty() &&
+        plan.type == PhysicalOperatorType::PROJECTION) {
+        auto &projection = plan.Cast<PhysicalProjection>();
+        vector<Value> values;
+        for (idx_t i = 0; i < column_names.size(); i++) {
+            auto &expr = *op.expressions[i];
+            if (expr.GetExpressionType() == ExpressionType::VALUE_DEFAULT) {
+                // Cassandra columns have no default
+                values.emplace_back(column_types[i]);
+                continue;
+            }
+            if (expr.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+                break;
+            }
+            auto &source = *projection.select_list[expr.Cast<BoundReferenceExpression>().index];
+            if (source.GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+                break;
+            }
+            values.push_back(source.Cast<BoundConstantExpression>().value.DefaultCastAs(column_types[i]));
+        }
+        if (values.size() == column_names.size()) {
+            string assignments;
+            for (auto &name : column_names) {
+                assignments += (assignments.empty() ? "" : ", ") + QuoteCQLIdentifier(name) + " = ?";
+            }
+            auto query = "UPDATE " + table_name + " SET " + assignments + " WHERE " + bind_data->filter_condition;
+            // An upsert writes every key it addresses
+            return planner.Make<CassandraModifyByKey>(op, table, CassandraWriteType::UPDATE_ROWS, query,
+                                                      std::move(column_names), std::move(values),
+                                                      bind_data->filter_params, bind_data->filter_key_count);
+        }
+    }
+
+    vector<unique_ptr<Expression>> expressions;
+    for (idx_t i = 0; i < column_names.size(); i++) {
+        auto &expr = op.expressions[i];
+        if (expr->GetExpressionType() == ExpressionType::VALUE_DEFAULT) {
+            expressions.push_back(make_uniq<BoundConstantExpression>(Value(column_types[i])));
+        } else {
+            expressions.push_back(expr->Copy());
+        }
+    }
+    CopyKeyExpressions(op.expressions, column_names.size(), primary_key.size(), table, "UPDATE", expressions);
+    column_names.insert(column_names.end(), primary_key.begin(), primary_key.end());
+    auto &modify = planner.Make<CassandraModify>(op, table, CassandraWriteType::UPDATE_ROWS, std::move(column_names),
+                                                 std::move(expressions));
+    modify.children.push_back(plan);
+    return modify;
+}
+
+class CassandraModifyGlobalState : public GlobalSinkState {
+public:
+    shared_ptr<CassandraWriteTarget> target;
+    // Set in an explicit transaction, which sends the rows when it commits
+    optional_ptr<CassandraTransaction> transaction;
+    std::atomic<idx_t> rows_buffered {0};
+};
+
+class CassandraModifyLocalState : public LocalSinkState {
+public:
+    CassandraModifyLocalState(ClientContext &context, shared_ptr<CassandraWriteTarget> target,
+                              const vector<unique_ptr<Expression>> &expressions)
+        : writer(std::move(target)), executor(context, expressions) {
+    }
+
+    CassandraWriter writer;
+    // Rows held for the transaction instead of being written
+    unique_ptr<ColumnDataCollection> buffer;
+    ExpressionExecutor executor;
+    // The written columns in the order of the prepared statement
+    DataChunk modify_chunk;
+};
+
+unique_ptr<GlobalSinkState> CassandraModify::GetGlobalSinkState(ClientContext &context) const {
+    auto &catalog = table.catalog.Cast<CassandraCatalog>();
+    auto result = make_uniq<CassandraModifyGlobalState>();
+    result->target = make_shared_ptr<CassandraWriteTarget>(
+        catalog.GetSharedClient(), table.GetTableRef(), type, column_names, column_types,
+        table.table_schema.partition_key, table.table_schema.clustering_key, catalog.config);
+    if (CassandraTransaction::BufferWrites(context)) {
+        result->transaction = CassandraTransaction::Get(context, catalog);
+    }
+    return std::move(result);
+}
+
+unique_ptr<LocalSinkState> CassandraModify::GetLocalSinkState(ExecutionContext &context) const {
+    auto &gstate = sink_state->Cast<CassandraModifyGlobalState>();
+    auto result = make_uniq<CassandraModifyLocalState>(context.client, gstate.target, expressions);
+    result->modify_chunk.Initialize(Allocator::Get(context.client), column_types);
+    if (gstate.transaction) {
+        result->buffer = make_uniq<ColumnDataCollection>(context.client, column_types);
+    }
+    return std::move(result);
+}
+
+SinkResultType CassandraModify::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+    auto &lstate = input.local_state.Cast<CassandraModifyLocalState>();
+    lstate.modify_chunk.Reset();
+    lstate.executor.Execute(chunk, lstate.modify_chunk);
+    if (lstate.buffer) {
+        lstate.buffer->Append(lstate.modify_chunk);
+    } else {
+        lstate.writer.Append(lstate.modify_chunk);
+    }
+    return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType CassandraModify::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+    auto &gstate = sink_state->Cast<CassandraModifyGlobalState>();
+    auto &lstate = input.local_state.Cast<CassandraModifyLocalState>();
+    if (lstate.buffer) {
+        gstate.rows_buffered += lstate.buffer->Count();
+        gstate.transaction->BufferRows(gstate.target, std::move(lstate.buffer));
+    } else {
+        lstate.writer.Flush();
+    }
+    return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType CassandraModify::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                           OperatorSinkFinalizeInput &input) const {
+    return SinkFinalizeType::READY;
+}
+
+SourceResultType CassandraModify::GetData(ExecutionContext &context, DataChunk &chunk,
+                                          OperatorSourceInput &input) const {
+    auto &gstate = sink_state->Cast<CassandraModifyGlobalState>();
+    chunk.SetCardinality(1);
+    chunk.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(gstate.target->rows_written + gstate.rows_buffered)));
+    return SourceResultType::FINISHED;
+}
+
+string CassandraModify::GetName() const {
+    return type == CassandraWriteType::DELETE_ROWS ? "CASSANDRA_DELETE" : "CASSANDRA_UPDATE";
+}
+
+InsertionOrderPreservingMap<string> CassandraModify::ParamsToString() const {
+    InsertionOrderPreservingMap<string> result;
+    result["Table Name"] = table.GetTableRef().GetQualifiedName();
+    return result;
+}
+
+CassandraModifyByKey::CassandraModifyByKey(PhysicalPlan &physical_plan, LogicalOperator &op,
+                                           CassandraTableEntry &table, CassandraWriteType type, string query,
+                                           vector<string> column_names, vector<Value> values,
+                                           vector<Value> filter_params, optional_idx row_count)
+    : PhysicalOperator(physical_plan, PhysicalOperatorType::EXTENSION, op.types, 1), table(table), type(type),
+      query(std::move(query)), column_names(std::move(column_names)), values(std::move(values)),
+      filter_params(std::move(filter_params)), row_count(row_count) {
+}
+
+SourceResultType CassandraModifyByKey::GetData(ExecutionContext &context, DataChunk &chunk,
+                                               OperatorSourceInput &input) const {
+    auto &catalog = table.catalog.Cast<CassandraCatalog>();
+    auto client = catalog.GetSharedClient();
+    auto table_name = table.GetTableRef().GetQualifiedName();
+
+    CassStatement* statement;
+    if (values.empty() && filter_params.empty()) {
+        statement = cass_statement_new_n(query.c_str(), query.size(), 0);
+    } else {
+        auto prepared = client->GetPrepared(query);
+        statement = cass_prepared_bind(prepared.get());
+        for (idx_t i = 0; i < values.size(); i++) {
+            CassError error;
+            if (values[i].IsNull()) {
+                error = cass_statement_bind_null(statement, i);
+            } else {
+                auto encoder =
+                    CassandraEncoder::GetEncoder(cass_prepared_parameter_data_type(prepared.get(), i), values[i].type());
+                Vector vector(values[i]);
+                RecursiveUnifiedVectorFormat format;
+                Vector::RecursiveToUnifiedFormat(vector, 1, format);
+                error = encoder.encode(encoder, format, 1, &statement, i);
+            }
+            if (error != CASS_OK) {
+                cass_statement_free(statement);
+                throw InvalidInputException("Cannot write column \"%s\" of %s: %s", column_names[i], table_name,
+                                            cass_error_desc(error));
+            }
+        }
+        CassandraFilterPushdown::BindParameters(statement, filter_params, values.size());
+    }
+    cass_statement_set_is_idempotent(statement, cass_true);
+    CassandraClient::ConfigureStatement(statement, catalog.config);
+
+    if (CassandraTransaction::BufferWrites(context.client)) {
+        CassandraTransaction::Get(context.client, table.catalog)
+            .BufferStatement(client, table.GetTableRef(), statement, query);
+    } else {
+        client->ExecuteStatement(statement, query);
+    }
+
+    // Cassandra does not report how many rows a statement changed, only the plan may know it
+    chunk.SetCardinality(1);
+    chunk.SetValue(0, 0,
+                   row_count.IsValid() ? Value::BIGINT(NumericCast<int64_t>(row_count.GetIndex()))
+                                       : Value(LogicalType::BIGINT));
+    return SourceResultType::FINISHED;
+}
+
+string CassandraModifyByKey::GetName() const {
+    return type == CassandraWriteType::DELETE_ROWS ? "CASSANDRA_DELETE" : "CASSANDRA_UPDATE";
+}
+
+InsertionOrderPreservingMap<string> CassandraModifyByKey::ParamsToString() const {
+    InsertionOrderPreservingMap<string> result;
+    result["Table Name"] = table.GetTableRef().GetQualifiedName();
+    result["Query"] = query;
+    return result;
+}
+
+} // namespace cassandra
+} // namespace duckdb
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/operator/logical_delete.hpp"
+#include "duckdb/planner/operator/logical_update.hpp"
+#include "cassandra_table_entry.hpp"
+#include "../include/cassandra_writer.hpp"
+
+namespace duckdb {
+namespace cassandra {
+
+// UPDATE or DELETE of an attached Cassandra table, for rows found by scanning it. The scan yields
+// the primary key of every matching row and each row becomes its own UPDATE or DELETE by key;
+// every thread sends them through its own CassandraWriter.
+class CassandraModify : public PhysicalOperator {
+public:
+    // expressions compute the written columns from the scanned chunks: the SET values followed by
+    // the primary key for an UPDATE, only the primary key for a DELETE
+    CassandraModify(PhysicalPlan &physical_plan, LogicalOperator &op, CassandraTableEntry &table,
+                    CassandraWriteType type, vector<string> column_names, vector<unique_ptr<Expression>> expressions);
+
+    CassandraTableEntry &table;
+    CassandraWriteType type;
+    vector<string> column_names;
+    vector<LogicalType> column_types;
+    vector<unique_ptr<Expression>> expressions;
+
+    // Plan a DELETE or UPDATE of a Cassandra table. When the scan below evaluates the whole WHERE
+    // clause in Cassandra, an UPDATE of whole primary keys to constants and a DELETE of a clustering
+    // range are sent as a single CQL statement; otherwise the scanned rows are modified one key at
+    // a time.
+    static PhysicalOperator &PlanDelete(ClientContext &context, PhysicalPlanGenerator &planner, LogicalDelete &op,
+                                        PhysicalOperator &plan);
+    static PhysicalOperator &PlanUpdate(ClientContext &context, PhysicalPlanGenerator &planner, LogicalUpdate &op,
+                                        PhysicalOperator &plan);
+
+public:
+    // Source interface
+    SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+    bool IsSource() const override {
+        return true;
+    }
+
+public:
+    // Sink interface
+    unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+    unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+    SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+    SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+    SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                              OperatorSinkFinalizeInput &input) const override;
+
+    bool IsSink() const override {
+        return true;
+    }
+
+    bool ParallelSink() const override {
+        return true;
+    }
+
+    // Every row is addressed by its own key, the order they arrive in does not matter
+    bool SinkOrderDependent() const override {
+        return false;
+    }
+
+    string GetName() const override;
+    InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+// UPDATE or DELETE whose WHERE clause went into the scan, sent as one CQL statement: an UPDATE of
+// whole primary keys, or a DELETE of a clustering range as a single range tombstone.
+class CassandraModifyByKey : public PhysicalOperator {
+public:
+    // query takes the SET values first, then the pushed down filter values. row_count is the
+    // number of rows it changes, reported as NULL when invalid.
+    CassandraModifyByKey(PhysicalPlan &physical_plan, LogicalOperator &op, CassandraTableEntry &table,
+                         CassandraWriteType type, string query, vector<string> column_names, vector<Value> values,
+                         vector<Value> filter_params, optional_idx row_count);
+
+    CassandraTableEntry &table;
+    CassandraWriteType type;
+    string query;
+    // Updated columns and the constants they are set to
+    vector<string> column_names;
+    vector<Value> values;
+    vector<Value> filter_params;
+    optional_idx row_count;
+
+public:
+    // Source interface
+    SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+    bool IsSource() const override {
+        return true;
+    }
+
+    string GetName() const override;
+    InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+} // namespace cassandra
+} // namespace duckdb
@@ -3,7 +3,12 @@
 #include "cassandra_catalog.hpp"
 #include "../include/cassandra_client.hpp"
 #include "cassandra_types.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/parser/constraints/unique_constraint.hpp"
 #include "duckdb/parser/parsed_data/create_table_info.hpp"
+#include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
+
+#include <algorithm>
 
 namespace duckdb {
 namespace cassandra {
@@ -12,9 +17,112 @@ CassandraSchemaEntry::CassandraSchemaEntry(Catalog &catalog, CreateSchemaInfo &i
     : SchemaCatalogEntry(catalog, info), keyspace_ref(keyspace_ref) {
 }
 
+namespace {
+
+// Name of the column of info called name, in the case it was created with
+string FindColumn(const CreateTableInfo &info, const string &name) {
+    for (auto &column : info.columns.Physical()) {
+        if (StringUtil::CIEquals(column.Name(), name)) {
+            return column.Name();
+        }
+    }
+    throw BinderException("Primary key column \"%s\" is not a column of table \"%s\"", name, info.table);
+}
+
+// Primary key of a new table. A PRIMARY KEY constraint makes its first column the partition key
+// and the rest clustering columns. CREATE TABLE AS has no constraints and takes the key from the
+// cassandra_partition_key and cassandra_clustering_key settings, where a clustering column may
+// be followed by ASC or DESC.
+void GetPrimaryKey(ClientContext &context, const CreateTableInfo &info, vector<string> &partition_key,
+                   vector<string> &clustering_key, vector<bool> &clustering_descending) {
+    for (auto &constraint : info.constraints) {
+        if (constraint->type != ConstraintType::UNIQUE) {
+            continue;
+        }
+        auto &unique = constraint->Cast<UniqueConstraint>();
+        if (!unique.IsPrimaryKey()) {
+            continue;
+        }
+        vector<string> names;
+        if (unique.HasIndex()) {
+            names.push_back(info.columns.GetColumn(unique.GetIndex()).Name());
+        } else {
+            names = unique.GetColumnNames();
+        }
+        for (idx_t i = 0; i < names.size(); i++) {
+            auto name = FindColumn(info, names[i]);
+            if (i == 0) {
+                partition_key.push_back(name);
+            } else {
+                clustering_key.push_back(name);
+                clustering_descending.push_back(false);
+            }
+        }
+        return;
+    }
+
+    Value value;
+    if (context.TryGetCurrentSetting("cassandra_partition_key", value) && !value.IsNull()) {
+        for (auto &name : StringUtil::Split(StringValue::Get(value), ',')) {
+            partition_key.push_back(FindColumn(info, StringUtil::Trim(name)));
+        }
+    }
+    if (partition_key.empty()) {
+        throw BinderException("Cassandra table \"%s\" needs a primary key: declare a PRIMARY KEY, or SET "
+                              "cassandra_partition_key (and cassandra_clustering_key) for CREATE TABLE AS",
+                              info.table);
+    }
+    if (context.TryGetCurrentSetting("cassandra_clustering_key", value) && !value.IsNull()) {
+        for (auto &entry : StringUtil::Split(StringValue::Get(value), ',')) {
+            auto name = StringUtil::Trim(entry);
+            bool descending = false;
+            auto space = name.find_last_of(' ');
+            if (space != string::npos) {
+                auto order = StringUtil::Upper(name.substr(space + 1));
+                if (order == "ASC" || order == "DESC") {
+                    descending = order == "DESC";
+                    name = StringUtil::Trim(name.substr(0, space));
+                }
+            }
+            clustering_key.push_back(FindColumn(info, name));
+            clustering_descending.push_back(descending);
+        }
+    }
+}
+
+} // namespace
+
 // Implementation of all required virtual methods
 optional_ptr<CatalogEntry> CassandraSchemaEntry::CreateTable(CatalogTransaction transaction, BoundCreateTableInfo &info) {
-    throw NotImplementedException("CreateTable not yet implemented");
+    auto &base = info.Base();
+    if (base.on_conflict == OnCreateConflict::REPLACE_ON_CONFLICT) {
+        throw NotImplementedException("REPLACE not supported for CREATE TABLE in Cassandra");
+    }
+    if (GetTable(base.table)) {
+        if (base.on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT) {
+            return nullptr;
+        }
+        throw CatalogException("Table \"%s\" already exists in keyspace \"%s\"", base.table,
+                               keyspace_ref.keyspace_name);
+    }
+    if (!transaction.context) {
+        throw InternalException("Creating a Cassandra table requires a client context");
+    }
+
+    vector<string> partition_key;
+    vector<string> clustering_key;
+    vector<bool> clustering_descending;
+    GetPrimaryKey(*transaction.context, base, partition_key, clustering_key, clustering_descending);
+
+    auto &cassandra_catalog = catalog.Cast<CassandraCatalog>();
+    auto table_ref = CassandraTableRef{keyspace_ref.keyspace_name, base.table};
+    cassandra_catalog.GetSharedClient()->CreateTable(*transaction.context, base, table_ref, partition_key,
+                                                     clustering_key, clustering_descending);
+    {
+        std::lock_guard<std::mutex> guard(table_lock);
+        table_names[base.table] = base.table;
+    }
+    return GetTable(base.table);
 }
 
 optional_ptr<CatalogEntry> CassandraSchemaEntry::CreateFunction(CatalogTransaction transaction, CreateFunctionInfo &info) {
@@ -58,18 +166,20 @@ void CassandraSchemaEntry::Alter(CatalogTransaction transaction, AlterInfo &info
 }
 
 void CassandraSchemaEntry::Scan(CatalogType type, const std::function<void(CatalogEntry &)> &callback) {
-    if (type == CatalogType::TABLE_ENTRY) {
-        
-        // Get real tables from Cassandra for this keyspace
-        vector<string> known_tables = {"events", "x", "users"};
-        
-        for (const auto& table_name : known_tables) {
-            auto table_ref = CassandraTableRef{keyspace_ref.keyspace_name, table_name};
-            CreateTableInfo table_info;
-            table_info.table = table_name;
-            table_info.schema = keyspace_ref.keyspace_name;
-            
-            auto table_entry = make_uniq<CassandraTableEntry>(catalog, *this, table_info, table_ref);
+    if (type != CatalogType::TABLE_ENTRY) {
+        return;
+    }
+    vector<string> names;
+    {
+        std::lock_guard<std::mutex> guard(table_lock);
+        for (auto &entry : table_names) {
+            names.push_back(entry.second);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    for (auto &table_name : names) {
+        auto table_entry = GetTable(table_name);
+        if (table_entry) {
             callback(*table_entry);
         }
     }
@@ -85,114 +195,76 @@ void CassandraSchemaEntry::DropEntry(ClientContext &context, DropInfo &info) {
 }
 
 optional_ptr<CatalogEntry> CassandraSchemaEntry::LookupEntry(CatalogTransaction transaction, const EntryLookupInfo &lookup_info) {
-    auto entry_name = lookup_info.GetEntryName();
+    if (lookup_info.GetCatalogType() != CatalogType::TABLE_ENTRY) {
+        return nullptr;
+    }
+    return GetTable(lookup_info.GetEntryName());
+}
+
+void CassandraSchemaEntry::SetTableNames(vector<string> names) {
+    std::lock_guard<std::mutex> guard(table_lock);
+    table_names.clear();
+    for (auto &name : names) {
+        table_names[name] = name;
+    }
+}
+
+optional_ptr<CassandraTableEntry> CassandraSchemaEntry::GetTable(const string &table_name) {
+    string stored_name;
+    {
+        std::lock_guard<std::mutex> guard(table_lock);
+        auto entry = tables.find(table_name);
+        if (entry != tables.end()) {
+            return entry->second.get();
+        }
+        auto name = table_names.find(table_name);
+        if (name == table_names.end()) {
+            return nullptr;
+        }
+        stored_name = name->second;
+    }
     
-    // Return a table entry for any table name requested
-    auto table_ref = CassandraTableRef{keyspace_ref.keyspace_name, entry_name};
+    // Loading may sample rows, so it runs without holding the lock
+    auto table_entry = LoadTable(stored_name);
+    if (!table_entry) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> guard(table_lock);
+    auto &cached = tables[stored_name];
+    if (!cached) {
+        cached = std::move(table_entry);
+    }
+    return cached.get();
+}
+
+unique_ptr<CassandraTableEntry> CassandraSchemaEntry::LoadTable(const string &table_name) {
+    auto table_ref = CassandraTableRef{keyspace_ref.keyspace_name, table_name};
     CreateTableInfo table_info;
-    table_info.table = entry_name;
+    table_info.table = table_name;
     table_info.schema = keyspace_ref.keyspace_name;
+    CassandraTableSchema schema;
     
-    // Get REAL columns from Cassandra dynamically - use shared connection for ATTACH
+    // Columns come from the driver's schema metadata, which also works for empty tables
     try {
         auto &cassandra_catalog = catalog.Cast<CassandraCatalog>();
         auto client = cassandra_catalog.GetSharedClient();
         
-        string schema_query = "SELECT * FROM " + keyspace_ref.keyspace_name + "." + entry_name + " LIMIT 1";
-        auto session = client->GetSession();
-        CassStatement* statement = cass_statement_new(schema_query.c_str(), 0);
-        CassFuture* result_future = cass_session_execute(session, statement);
-        
-        if (cass_future_error_code(result_future) == CASS_OK) {
-            const CassResult* result = cass_future_get_result(result_future);
-            size_t column_count = cass_result_column_count(result);
-                        
-            for (size_t i = 0; i < column_count; i++) {
-                const char* column_name;
-                size_t name_length;
-                cass_result_column_name(result, i, &column_name, &name_length);
-                string col_name(column_name, name_length);
-                
-                // Map Cassandra types to proper DuckDB types
-                CassValueType cass_type = cass_result_column_type(result, i);
-                LogicalType duckdb_type;
-                
-                switch (cass_type) {
-                    case CASS_VALUE_TYPE_UUID:
-                    case CASS_VALUE_TYPE_TIMEUUID:
-                        duckdb_type = LogicalType::UUID;
-                        break;
-                    case CASS_VALUE_TYPE_TIMESTAMP:
-                        duckdb_type = LogicalType::TIMESTAMP_TZ;
-                        break;
-                    case CASS_VALUE_TYPE_DOUBLE:
-                        duckdb_type = LogicalType::DOUBLE;
-                        break;
-                    case CASS_VALUE_TYPE_INT:
-                        duckdb_type = LogicalType::INTEGER;
-                        break;
-                    case CASS_VALUE_TYPE_BIGINT:
-                        duckdb_type = LogicalType::BIGINT;
-                        break;
-                    case CASS_VALUE_TYPE_BOOLEAN:
-                        duckdb_type = LogicalType::BOOLEAN;
-                        break;
-                    case CASS_VALUE_TYPE_FLOAT:
-                        duckdb_type = LogicalType::FLOAT;
-                        break;
-                    case CASS_VALUE_TYPE_SMALL_INT:
-                        duckdb_type = LogicalType::SMALLINT;
-                        break;
-                    case CASS_VALUE_TYPE_TINY_INT:
-                        duckdb_type = LogicalType::TINYINT;
-                        break;
-                    case CASS_VALUE_TYPE_DATE:
-                        duckdb_type = LogicalType::DATE;
-                        break;
-                    case CASS_VALUE_TYPE_TIME:
-                        duckdb_type = LogicalType::TIME;
-                        break;
-                    case CASS_VALUE_TYPE_INET:
-                        duckdb_type = LogicalType::VARCHAR;  // INET as string
-                        break;
-                    case CASS_VALUE_TYPE_DECIMAL:
-                    case CASS_VALUE_TYPE_VARINT:
-                        duckdb_type = LogicalType::VARCHAR;  // Large numbers as strings
-                        break;
-                    case CASS_VALUE_TYPE_BLOB:
-                        duckdb_type = LogicalType::BLOB;
-                        break;
-                    case CASS_VALUE_TYPE_LIST:
-                    case CASS_VALUE_TYPE_SET:
-                    case CASS_VALUE_TYPE_MAP:
-                        duckdb_type = LogicalType::VARCHAR;  // Collections as JSON strings
-                        break;
-                    default:
-                        duckdb_type = LogicalType::VARCHAR;
-                        break;
-                }
-                
-                table_info.columns.AddColumn(ColumnDefinition(col_name, duckdb_type));
-            }
-            
-            cass_result_free(result);
+        if (!client->GetTableSchema(keyspace_ref.keyspace_name, table_name, schema)) {
+            return nullptr;
+        }
+        for (idx_t i = 0; i < schema.column_names.size(); i++) {
+            auto type = CassandraTypeMapper::ToDuckDBType(schema.column_types[i], cassandra_catalog.config.decimal_scale);
+            table_info.columns.AddColumn(ColumnDefinition(schema.column_names[i], std::move(type)));
         }
-        
-        cass_future_free(result_future);
-        cass_statement_free(statement);
         
     } catch (const std::exception& e) {
         throw BinderException("Failed to get schema for table '%s.%s': %s", 
-                            keyspace_ref.keyspace_name.c_str(), entry_name.c_str(), e.what());
-    }
-    
-    // Ensure we actually have columns
-    if (table_info.columns.LogicalColumnCount() == 0) {
-        throw BinderException("Table '%s.%s' has no columns or does not exist", 
-                            keyspace_ref.keyspace_name.c_str(), entry_name.c_str());
+                            keyspace_ref.keyspace_name.c_str(), table_name.c_str(), e.what());
     }
     
-    return make_uniq<CassandraTableEntry>(catalog, *this, table_info, table_ref).release();
+    auto table_entry = make_uniq<CassandraTableEntry>(catalog, *this, table_info, table_ref);
+    table_entry->table_schema = std::move(schema);
+    return table_entry;
 }
 
 } // namespace cassandra
@@ -3,6 +3,9 @@
 #include "duckdb.hpp"
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "../include/cassandra_utils.hpp"
+#include "cassandra_table_entry.hpp"
+
+#include <mutex>
 
 namespace duckdb {
 namespace cassandra {
@@ -30,8 +33,20 @@ public:
     
     optional_ptr<CatalogEntry> LookupEntry(CatalogTransaction transaction, const EntryLookupInfo &lookup_info) override;
 
+    // Tables of the keyspace as of the schema version the entry was created at
+    void SetTableNames(vector<string> names);
+
 private:
     CassandraKeyspaceRef keyspace_ref;
+    
+    // Build the entry of a table from the schema metadata, nullptr if it no longer exists
+    unique_ptr<CassandraTableEntry> LoadTable(const string &table_name);
+    optional_ptr<CassandraTableEntry> GetTable(const string &table_name);
+    
+    // Table entries are loaded on first use and live as long as this schema entry
+    std::mutex table_lock;
+    case_insensitive_map_t<string> table_names;
+    case_insensitive_map_t<unique_ptr<CassandraTableEntry>> tables;
 };
 
 } // namespace cassandra
@@ -1,6 +1,8 @@
 #include "cassandra_table_entry.hpp"
 #include "cassandra_catalog.hpp"
+#include "cassandra_transaction.hpp"
 #include "../include/cassandra_scan.hpp"
+#include "../include/cassandra_client.hpp"
 
 namespace duckdb {
 namespace cassandra {
@@ -10,11 +12,29 @@ CassandraTableEntry::CassandraTableEntry(Catalog &catalog, SchemaCatalogEntry &s
 }
 
 unique_ptr<BaseStatistics> CassandraTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
-    // TODO: Return table statistics
-    return nullptr;
+    if (column_id >= columns.LogicalColumnCount()) {
+        return nullptr;
+    }
+    auto &column = columns.GetColumn(LogicalIndex(column_id));
+    auto statistics = GetTableStatistics(context);
+    return statistics->GetColumnStatistics(column.Name(), column.Type());
+}
+
+shared_ptr<const CassandraTableStatistics> CassandraTableEntry::GetTableStatistics(ClientContext &context) {
+    auto &cassandra_catalog = catalog.Cast<CassandraCatalog>();
+    return cassandra_catalog.GetSharedClient()->GetTableStatistics(context, table_ref, table_schema.partition_key,
+                                                                   table_schema.clustering_key, cassandra_catalog.config);
 }
 
 TableFunction CassandraTableEntry::GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) {
+    // A scan reads Cassandra, where the writes held back by the transaction are not yet
+    if (CassandraTransaction::BufferWrites(context) &&
+        CassandraTransaction::Get(context, catalog).HasBufferedWrites(table_ref)) {
+        throw TransactionException("Cannot read Cassandra table %s after writing to it in the same transaction, "
+                                   "its writes are only sent on COMMIT",
+                                   table_ref.GetQualifiedName());
+    }
+    
     // Create bind data for this specific table
     auto cassandra_bind_data = make_uniq<CassandraScanBindData>();
     cassandra_bind_data->table_ref = table_ref;
@@ -25,6 +45,13 @@ TableFunction CassandraTableEntry::GetScanFunction(ClientContext &context, uniqu
     
     // Reuse the catalog's connection to avoid creating new connections
     cassandra_bind_data->reused_connection = cassandra_catalog.GetSharedClient();
+    cassandra_bind_data->LoadKeyColumns(table_schema);
+    for (auto &column : columns.Logical()) {
+        cassandra_bind_data->column_names.push_back(column.Name());
+        cassandra_bind_data->column_types.push_back(column.Type());
+    }
+    cassandra_bind_data->column_cass_types = table_schema.column_types;
+    cassandra_bind_data->BindDecoders();
     
     bind_data = std::move(cassandra_bind_data);
     
@@ -34,7 +61,7 @@ TableFunction CassandraTableEntry::GetScanFunction(ClientContext &context, uniqu
 
 TableStorageInfo CassandraTableEntry::GetStorageInfo(ClientContext &context) {
     TableStorageInfo info;
-    info.cardinality = 0;
+    info.cardinality = GetTableStatistics(context)->rows;
     info.index_info = vector<IndexInfo>();
     return info;
 }
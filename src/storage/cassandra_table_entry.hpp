@@ -2,7 +2,10 @@
 
 #include "duckdb.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "../include/cassandra_types.hpp"
 #include "../include/cassandra_utils.hpp"
+#include "../include/cassandra_client.hpp"
+#include <cassandra.h>
 
 namespace duckdb {
 namespace cassandra {
@@ -17,8 +20,18 @@ public:
     
     TableStorageInfo GetStorageInfo(ClientContext &context) override;
 
+    const CassandraTableRef &GetTableRef() const {
+        return table_ref;
+    }
+
+    // Cassandra types and primary key of the table, used to set up the scan
+    CassandraTableSchema table_schema;
+
 private:
     CassandraTableRef table_ref;
+    
+    // Size estimates and key statistics, cached by the client
+    shared_ptr<const CassandraTableStatistics> GetTableStatistics(ClientContext &context);
 };
 
 } // namespace cassandra
@@ -1,29 +1,142 @@
 #include "cassandra_transaction.hpp"
+#include "cassandra_schema_entry.hpp"
+#include "../include/cassandra_client.hpp"
+#include "duckdb/main/client_context.hpp"
 
 namespace duckdb {
 namespace cassandra {
 
-CassandraTransactionManager::CassandraTransactionManager(AttachedDatabase &db) 
+CassandraTransaction::CassandraTransaction(CassandraTransactionManager &manager, ClientContext &context)
+    : Transaction(manager, context) {
+}
+
+CassandraTransaction::~CassandraTransaction() {
+    // Statements of a rolled back or failed transaction were never sent
+    for (auto &write : writes) {
+        if (write.statement) {
+            cass_statement_free(write.statement);
+        }
+    }
+}
+
+CassandraTransaction &CassandraTransaction::Get(ClientContext &context, Catalog &catalog) {
+    return Transaction::Get(context, catalog).Cast<CassandraTransaction>();
+}
+
+bool CassandraTransaction::BufferWrites(ClientContext &context) {
+    return !context.transaction.IsAutoCommit();
+}
+
+static bool SameColumns(const CassandraWriteTarget &a, const CassandraWriteTarget &b) {
+    return a.table_ref.GetQualifiedName() == b.table_ref.GetQualifiedName() && a.type == b.type &&
+           a.column_names == b.column_names && a.column_types == b.column_types;
+}
+
+void CassandraTransaction::BufferRows(shared_ptr<CassandraWriteTarget> target, unique_ptr<ColumnDataCollection> rows) {
+    if (rows->Count() == 0) {
+        return;
+    }
+    lock_guard<mutex> guard(write_lock);
+    if (!writes.empty() && writes.back().target && SameColumns(*writes.back().target, *target)) {
+        // Appending chunk by chunk fills up the last chunk, where Combine would keep every
+        // single row INSERT in a chunk of its own
+        auto &buffered = *writes.back().rows;
+        for (auto &chunk : rows->Chunks()) {
+            buffered.Append(chunk);
+        }
+        return;
+    }
+    BufferedWrite write;
+    write.target = std::move(target);
+    write.rows = std::move(rows);
+    writes.push_back(std::move(write));
+}
+
+void CassandraTransaction::BufferStatement(shared_ptr<CassandraClient> client, const CassandraTableRef &table_ref,
+                                           CassStatement* statement, string query) {
+    lock_guard<mutex> guard(write_lock);
+    BufferedWrite write;
+    write.client = std::move(client);
+    write.table = table_ref.GetQualifiedName();
+    write.statement = statement;
+    write.query = std::move(query);
+    writes.push_back(std::move(write));
+}
+
+bool CassandraTransaction::HasBufferedWrites(const CassandraTableRef &table_ref) {
+    auto table = table_ref.GetQualifiedName();
+    lock_guard<mutex> guard(write_lock);
+    for (auto &write : writes) {
+        if ((write.target ? write.target->table_ref.GetQualifiedName() : write.table) == table) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CassandraTransaction::KeepAlive(shared_ptr<CassandraSchemaEntry> entry) {
+    lock_guard<mutex> guard(entry_lock);
+    auto key = entry.get();
+    schema_entries.emplace(key, std::move(entry));
+}
+
+void CassandraTransaction::Flush() {
+    lock_guard<mutex> guard(write_lock);
+    for (auto &write : writes) {
+        if (write.statement) {
+            auto statement = write.statement;
+            write.statement = nullptr;
+            write.client->ExecuteStatement(statement, write.query);
+            continue;
+        }
+        // Rows of a statement stay in flight together, up to write_concurrency requests
+        CassandraWriter writer(write.target);
+        for (auto &chunk : write.rows->Chunks()) {
+            writer.Append(chunk);
+        }
+        writer.Flush();
+        write.rows.reset();
+    }
+    writes.clear();
+}
+
+CassandraTransactionManager::CassandraTransactionManager(AttachedDatabase &db)
     : TransactionManager(db) {
 }
 
 Transaction &CassandraTransactionManager::StartTransaction(ClientContext &context) {
-    // Create a simple transaction for Cassandra
-    auto transaction = make_uniq<Transaction>(*this, context);
+    auto transaction = make_uniq<CassandraTransaction>(*this, context);
     auto &result = *transaction;
     lock_guard<mutex> l(transaction_lock);
-    // Store transaction using a simple counter as key
-    static transaction_t next_transaction_id = 1;
-    transactions[next_transaction_id++] = std::move(transaction);
+    transactions[result] = std::move(transaction);
+    return result;
+}
+
+unique_ptr<CassandraTransaction> CassandraTransactionManager::RemoveTransaction(Transaction &transaction) {
+    lock_guard<mutex> l(transaction_lock);
+    auto entry = transactions.find(transaction);
+    if (entry == transactions.end()) {
+        throw InternalException("Cassandra transaction was not started by this transaction manager");
+    }
+    auto result = std::move(entry->second);
+    transactions.erase(entry);
     return result;
 }
 
 ErrorData CassandraTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction) {
+    // DuckDB does not roll back a transaction whose commit failed, so it goes either way
+    auto cassandra_transaction = RemoveTransaction(transaction);
+    try {
+        cassandra_transaction->Flush();
+    } catch (std::exception &ex) {
+        return ErrorData(ex);
+    }
     return ErrorData();
 }
 
 void CassandraTransactionManager::RollbackTransaction(Transaction &transaction) {
-    // No-op for Cassandra
+    // The buffered writes are dropped with the transaction
+    RemoveTransaction(transaction);
 }
 
 void CassandraTransactionManager::Checkpoint(ClientContext &context, bool force) {
@@ -31,4 +144,4 @@ void CassandraTransactionManager::Checkpoint(ClientContext &context, bool force)
 }
 
 } // namespace cassandra
-} // namespace duckdb
\ No newline at end of file
+} // namespace duckdb
@@ -1,24 +1,86 @@
 #pragma once
 
 #include "duckdb.hpp"
+#include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/transaction/transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
+#include "../include/cassandra_writer.hpp"
 
 namespace duckdb {
 namespace cassandra {
 
+class CassandraSchemaEntry;
+class CassandraTransactionManager;
+
+// Transaction on an attached Cassandra database. Cassandra has no transactions, so the writes made
+// inside BEGIN ... COMMIT are held back and sent when the transaction commits; a rollback drops
+// them. Scans read Cassandra and would not see the held back writes, so a table the transaction
+// has written to cannot be read until it commits.
+class CassandraTransaction : public Transaction {
+public:
+    CassandraTransaction(CassandraTransactionManager &manager, ClientContext &context);
+    ~CassandraTransaction() override;
+
+    // Transaction of catalog that the statement of context runs in
+    static CassandraTransaction &Get(ClientContext &context, Catalog &catalog);
+    // Whether writes of the statement of context are buffered, which they are in an explicit
+    // transaction only. Auto-commit statements write directly.
+    static bool BufferWrites(ClientContext &context);
+
+    // Buffer rows for target. Rows of consecutive statements writing the same columns of the same
+    // table are collected together, so the writer groups more rows of a partition into a batch.
+    void BufferRows(shared_ptr<CassandraWriteTarget> target, unique_ptr<ColumnDataCollection> rows);
+    // Buffer a bound statement writing table_ref, sent as it is. The transaction frees it.
+    void BufferStatement(shared_ptr<CassandraClient> client, const CassandraTableRef &table_ref,
+                         CassStatement* statement, string query);
+    // Whether writes into table_ref are buffered
+    bool HasBufferedWrites(const CassandraTableRef &table_ref);
+
+    // Keep a catalog entry alive until the transaction ends, even if the catalog drops it from its
+    // cache when the schema changes
+    void KeepAlive(shared_ptr<CassandraSchemaEntry> entry);
+
+    // Send the buffered writes in the order they were made; each one is acknowledged before the
+    // next is sent. A write that fails throws and the rest is not sent.
+    void Flush();
+
+private:
+    struct BufferedWrite {
+        // Rows written through target
+        shared_ptr<CassandraWriteTarget> target;
+        unique_ptr<ColumnDataCollection> rows;
+        // Or a single statement into table sent through client
+        shared_ptr<CassandraClient> client;
+        string table;
+        CassStatement* statement = nullptr;
+        string query;
+    };
+
+    // Sinks of a statement buffer from several threads
+    mutex write_lock;
+    vector<BufferedWrite> writes;
+
+    mutex entry_lock;
+    unordered_map<const CassandraSchemaEntry*, shared_ptr<CassandraSchemaEntry>> schema_entries;
+};
+
 class CassandraTransactionManager : public TransactionManager {
 public:
     CassandraTransactionManager(AttachedDatabase &db);
-    
+
     Transaction &StartTransaction(ClientContext &context) override;
     ErrorData CommitTransaction(ClientContext &context, Transaction &transaction) override;
     void RollbackTransaction(Transaction &transaction) override;
     void Checkpoint(ClientContext &context, bool force = false) override;
-    
+
 private:
+    // Take transaction out of the active ones, it is freed with the returned pointer
+    unique_ptr<CassandraTransaction> RemoveTransaction(Transaction &transaction);
+
     mutex transaction_lock;
-    unordered_map<transaction_t, unique_ptr<Transaction>> transactions;
+    reference_map_t<Transaction, unique_ptr<CassandraTransaction>> transactions;
 };
 
 } // namespace cassandra
-} // namespace duckdb
\ No newline at end of file
+} // namespace duckdb
@@ -0,0 +1,88 @@
+// Micro-benchmark for UUID decoding: string round trip vs direct field conversion.
+// Needs no Cassandra cluster, only the driver and DuckDB headers/libraries (see README.md).
+#include "cassandra_types.hpp"
+#include "duckdb/common/types/uuid.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace duckdb;
+using namespace duckdb::cassandra;
+
+static hugeint_t DecodeViaString(const CassUuid &uuid) {
+    char uuid_str[CASS_UUID_STRING_LENGTH];
+    cass_uuid_string(uuid, uuid_str);
+    hugeint_t result;
+    UUID::FromCString(uuid_str, strlen(uuid_str), result);
+    return result;
+}
+
+template <class FUNC>
+static double TimeDecode(const std::vector<CassUuid> &uuids, int rounds, FUNC decode, uint64_t &checksum) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (auto &uuid : uuids) {
+            auto value = decode(uuid);
+            checksum += value.lower ^ static_cast<uint64_t>(value.upper);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    const size_t uuid_count = 1000000;
+    const int rounds = 10;
+
+    // Mix of random (v4) and time based (v1) UUIDs
+    CassUuidGen* uuid_gen = cass_uuid_gen_new();
+    std::vector<CassUuid> uuids(uuid_count);
+    for (size_t i = 0; i < uuid_count; i++) {
+        if (i % 2 == 0) {
+            cass_uuid_gen_random(uuid_gen, &uuids[i]);
+        } else {
+            cass_uuid_gen_time(uuid_gen, &uuids[i]);
+        }
+    }
+    cass_uuid_gen_free(uuid_gen);
+
+    // Both paths must produce the same bits, and the same ordering as the UUID strings
+    for (size_t i = 0; i < uuid_count; i++) {
+        auto expected = DecodeViaString(uuids[i]);
+        auto actual = CassandraTypeMapper::UUIDToHugeint(uuids[i]);
+        if (expected != actual) {
+            std::cerr << "Mismatch for UUID " << UUID::ToString(expected) << std::endl;
+            return 1;
+        }
+        auto round_trip = CassandraTypeMapper::HugeintToUUID(actual);
+        if (round_trip.time_and_version != uuids[i].time_and_version ||
+            round_trip.clock_seq_and_node != uuids[i].clock_seq_and_node) {
+            std::cerr << "Round trip failed for UUID " << UUID::ToString(expected) << std::endl;
+            return 1;
+        }
+        if (i > 0) {
+            auto previous = CassandraTypeMapper::UUIDToHugeint(uuids[i - 1]);
+            bool string_less = UUID::ToString(previous) < UUID::ToString(actual);
+            if (string_less != (previous < actual)) {
+                std::cerr << "Ordering differs for UUID " << UUID::ToString(expected) << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    uint64_t checksum = 0;
+    double string_ms = TimeDecode(uuids, rounds, DecodeViaString, checksum);
+    double direct_ms = TimeDecode(uuids, rounds, CassandraTypeMapper::UUIDToHugeint, checksum);
+
+    double decoded = static_cast<double>(uuid_count) * rounds;
+    std::cout << "Decoded " << static_cast<uint64_t>(decoded) << " UUIDs per method (checksum " << checksum << ")"
+              << std::endl;
+    std::cout << "  string round trip: " << string_ms << " ms (" << string_ms * 1e6 / decoded << " ns/value)"
+              << std::endl;
+    std::cout << "  direct conversion: " << direct_ms << " ms (" << direct_ms * 1e6 / decoded << " ns/value)"
+              << std::endl;
+    std::cout << "  speedup: " << string_ms / direct_ms << "x" << std::endl;
+    return 0;
+}